@@ -10,7 +10,7 @@ ABaseCharacter::ABaseCharacter()
 {
     PrimaryActorTick.bCanEverTick = true;
 
-    // Character movement 
+    // Character movement 설정
     GetCharacterMovement()->bOrientRotationToMovement = false;
     GetCharacterMovement()->MaxWalkSpeed = WalkSpeed;
     GetCharacterMovement()->NavAgentProps.bCanCrouch = true;
@@ -134,19 +134,19 @@ void ABaseCharacter::ToggleCrouch()
 
 void ABaseCharacter::Interact()
 {
-    // ȣۿ  (  )
+    // 상호작용 실행 (아직 구현되지 않음)
     UE_LOG(LogTemp, Display, TEXT("Interact button pressed"));
 
-    // ȣۿ  Ŀ 
+    // 상호작용 로직은 후에 구현
     FVector Start = CameraComponent->GetComponentLocation();
     FVector ForwardVector = CameraComponent->GetForwardVector();
-    FVector End = Start + (ForwardVector * 200.0f); // 200cm  ĳ
+    FVector End = Start + (ForwardVector * 200.0f); // 200cm 레이 캐스팅
 
     FHitResult HitResult;
     FCollisionQueryParams QueryParams;
     QueryParams.AddIgnoredActor(this);
 
-    //  Ʈ̽ 
+    // 레이 트레이스 수행
     if (GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_Visibility, QueryParams))
     {
         AActor* HitActor = HitResult.GetActor();
@@ -154,7 +154,7 @@ void ABaseCharacter::Interact()
         if (HitActor)
         {
             UE_LOG(LogTemp, Display, TEXT("Hit Actor: %s"), *HitActor->GetName());
-            // Ŀ ȣۿ ̽  
+            // 후에 상호작용 인터페이스 구현 예정
         }
     }
 }
\ No newline at end of file
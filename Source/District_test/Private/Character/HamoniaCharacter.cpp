@@ -182,7 +182,7 @@ void AHamoniaCharacter::InitializeDialogueSystem()
 {
 	if (DialogueManager && DefaultDialogueDataTable)
 	{
-		DialogueManager->DialogueDataTable = DefaultDialogueDataTable;
+		DialogueManager->SetDialogueDataTable(DefaultDialogueDataTable);
 	}
 }
 
@@ -200,9 +200,10 @@ void AHamoniaCharacter::Tick(float DeltaTime)
 		bIsLookingAtInteractable = false;
 		CurrentInteractableActor = nullptr;
 		CurrentInteractionText.Empty();
+		FocusViewState.bForceRefresh = true;
 	}
 
-	CheckForInteractables();
+	UpdateInteractionFocus();
 
 	if (bShowDebugLines)
 	{
@@ -416,6 +417,7 @@ void AHamoniaCharacter::OnEKeyPressed()
 
 void AHamoniaCharacter::Interact()
 {
+	RequestInteractionFocusRefresh();
 
 
 	if (DialogueManager)
@@ -553,16 +555,43 @@ AActor* AHamoniaCharacter::GetHeldObject()
 	return nullptr;
 }
 
-void AHamoniaCharacter::CheckForInteractables()
+UInteractionFocusSubsystem* AHamoniaCharacter::GetFocusSubsystem() const
+{
+	UWorld* World = GetWorld();
+	return World ? World->GetSubsystem<UInteractionFocusSubsystem>() : nullptr;
+}
+
+void AHamoniaCharacter::RequestInteractionFocusRefresh()
 {
-	if (CurrentInteractableActor && IsValid(CurrentInteractableActor))
+	FocusViewState.bForceRefresh = true;
+}
+
+void AHamoniaCharacter::UpdateInteractionFocus()
+{
+	UInteractionFocusSubsystem* FocusSubsystem = GetFocusSubsystem();
+	if (!FocusSubsystem || !CameraComponent)
 	{
-		if (CurrentInteractableActor->GetClass()->ImplementsInterface(UInteractableInterface::StaticClass()))
-		{
-			IInteractableInterface::Execute_HideInteractionWidget(CurrentInteractableActor);
-		}
+		CheckForInteractables();
+		return;
 	}
 
+	if (FocusSubsystem->ShouldRetrace(FocusViewState, CameraComponent->GetComponentLocation(), CameraComponent->GetForwardVector(),
+		FocusMoveThreshold, FocusAngleThreshold, FocusRefreshInterval))
+	{
+		CheckForInteractables();
+	}
+}
+
+void AHamoniaCharacter::CheckForInteractables()
+{
+	AActor* HeldObject = GetHeldObject();
+	SetInteractionFocus(FindInteractionTarget(HeldObject));
+}
+
+AActor* AHamoniaCharacter::FindInteractionTarget(AActor* HeldObject)
+{
+	UInteractionFocusSubsystem* FocusSubsystem = GetFocusSubsystem();
+
 	FVector Start = CameraComponent->GetComponentLocation();
 	FVector End = Start + (CameraComponent->GetForwardVector() * InteractionDistance);
 	FHitResult HitResult;
@@ -571,7 +600,6 @@ void AHamoniaCharacter::CheckForInteractables()
 	QueryParams.bTraceComplex = false;
 	QueryParams.bReturnPhysicalMaterial = false;
 
-	AActor* HeldObject = GetHeldObject();
 	if (HeldObject)
 	{
 		QueryParams.AddIgnoredActor(HeldObject);
@@ -579,93 +607,108 @@ void AHamoniaCharacter::CheckForInteractables()
 
 	ECollisionChannel TraceChannel = ECC_Visibility;
 
-	bIsLookingAtInteractable = false;
-	CurrentInteractableActor = nullptr;
-	CurrentInteractionText.Empty();
-	CurrentInteractionType = EInteractionType::Default;
-
 	bool bHit = GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, TraceChannel, QueryParams);
 
 	if (bHit)
 	{
 		AActor* HitActor = HitResult.GetActor();
+		bool bImplements = FocusSubsystem ? FocusSubsystem->ImplementsInteractable(HitActor)
+			: (HitActor && HitActor->GetClass()->ImplementsInterface(UInteractableInterface::StaticClass()));
 
-		if (HitActor && HitActor != HeldObject && HitActor->GetClass()->ImplementsInterface(UInteractableInterface::StaticClass()))
+		if (HitActor && HitActor != HeldObject && bImplements)
 		{
-			bool bCanInteractResult = IInteractableInterface::Execute_CanInteract(HitActor, this);
-
-			if (bCanInteractResult)
+			if (IInteractableInterface::Execute_CanInteract(HitActor, this))
 			{
-				bIsLookingAtInteractable = true;
-				CurrentInteractableActor = HitActor;
-				CurrentInteractionText = IInteractableInterface::Execute_GetInteractionText(HitActor);
-				CurrentInteractionType = IInteractableInterface::Execute_GetInteractionType(HitActor);
+				return HitActor;
 			}
 		}
 	}
 
-	if (!bIsLookingAtInteractable)
-	{
-		float ClosestDistance = InteractionDistance;
-		AActor* ClosestActor = nullptr;
+	float ClosestDistance = InteractionDistance;
+	AActor* ClosestActor = nullptr;
 
-		for (TActorIterator<AUnia> It(GetWorld()); It; ++It)
+	for (TActorIterator<AUnia> It(GetWorld()); It; ++It)
+	{
+		AUnia* Unia = *It;
+		if (IsValid(Unia))
 		{
-			AUnia* Unia = *It;
-			if (IsValid(Unia))
+			float Distance = FVector::Distance(GetActorLocation(), Unia->GetActorLocation());
+			if (Distance < ClosestDistance && Unia->CanInteract_Implementation(this))
 			{
-				float Distance = FVector::Distance(GetActorLocation(), Unia->GetActorLocation());
-				if (Distance < ClosestDistance && Unia->CanInteract_Implementation(this))
-				{
-					ClosestDistance = Distance;
-					ClosestActor = Unia;
-				}
+				ClosestDistance = Distance;
+				ClosestActor = Unia;
 			}
 		}
+	}
 
-		for (TActorIterator<APedestal> It(GetWorld()); It; ++It)
+	for (TActorIterator<APedestal> It(GetWorld()); It; ++It)
+	{
+		APedestal* Pedestal = *It;
+		if (IsValid(Pedestal))
 		{
-			APedestal* Pedestal = *It;
-			if (IsValid(Pedestal))
+			float Distance = FVector::Distance(GetActorLocation(), Pedestal->GetActorLocation());
+			if (Distance < ClosestDistance)
 			{
-				float Distance = FVector::Distance(GetActorLocation(), Pedestal->GetActorLocation());
-				if (Distance < ClosestDistance)
-				{
-					ClosestDistance = Distance;
-					ClosestActor = Pedestal;
-				}
+				ClosestDistance = Distance;
+				ClosestActor = Pedestal;
 			}
 		}
+	}
 
-		for (TActorIterator<APickupActor> It(GetWorld()); It; ++It)
+	for (TActorIterator<APickupActor> It(GetWorld()); It; ++It)
+	{
+		APickupActor* PickupActor = *It;
+		if (IsValid(PickupActor) && PickupActor != HeldObject)
 		{
-			APickupActor* PickupActor = *It;
-			if (IsValid(PickupActor) && PickupActor != HeldObject)
+			float Distance = FVector::Distance(GetActorLocation(), PickupActor->GetActorLocation());
+			if (Distance < ClosestDistance)
 			{
-				float Distance = FVector::Distance(GetActorLocation(), PickupActor->GetActorLocation());
-				if (Distance < ClosestDistance)
-				{
-					ClosestDistance = Distance;
-					ClosestActor = PickupActor;
-				}
+				ClosestDistance = Distance;
+				ClosestActor = PickupActor;
 			}
 		}
+	}
+
+	return ClosestActor;
+}
+
+void AHamoniaCharacter::SetInteractionFocus(AActor* NewFocus)
+{
+	UInteractionFocusSubsystem* FocusSubsystem = GetFocusSubsystem();
 
-		if (ClosestActor)
+	// 포커스가 실제로 바뀔 때만 위젯 Show/Hide
+	if (NewFocus != CurrentInteractableActor)
+	{
+		if (CurrentInteractableActor && IsValid(CurrentInteractableActor) &&
+			(!FocusSubsystem || FocusSubsystem->ImplementsInteractable(CurrentInteractableActor)))
 		{
-			bIsLookingAtInteractable = true;
-			CurrentInteractableActor = ClosestActor;
-			CurrentInteractionText = IInteractableInterface::Execute_GetInteractionText(ClosestActor);
-			CurrentInteractionType = IInteractableInterface::Execute_GetInteractionType(ClosestActor);
+			IInteractableInterface::Execute_HideInteractionWidget(CurrentInteractableActor);
 		}
-	}
 
-	if (bIsLookingAtInteractable && CurrentInteractableActor)
-	{
-		if (CurrentInteractableActor->GetClass()->ImplementsInterface(UInteractableInterface::StaticClass()))
+		CurrentInteractableActor = NewFocus;
+
+		if (NewFocus && (!FocusSubsystem || FocusSubsystem->ImplementsInteractable(NewFocus)))
 		{
-			IInteractableInterface::Execute_ShowInteractionWidget(CurrentInteractableActor);
+			IInteractableInterface::Execute_ShowInteractionWidget(NewFocus);
 		}
+
+		if (FocusSubsystem)
+		{
+			FocusSubsystem->RecordFocusChange();
+		}
+	}
+
+	bIsLookingAtInteractable = NewFocus != nullptr;
+
+	if (NewFocus)
+	{
+		CurrentInteractionText = IInteractableInterface::Execute_GetInteractionText(NewFocus);
+		CurrentInteractionType = IInteractableInterface::Execute_GetInteractionType(NewFocus);
+	}
+	else
+	{
+		CurrentInteractionText.Empty();
+		CurrentInteractionType = EInteractionType::Default;
 	}
 }
 
@@ -757,7 +800,7 @@ bool AHamoniaCharacter::HandleInventoryItemInteraction(UItem* Item, AActor* Targ
 		return false;
 	}
 
-	// PuzzleStarter ȣۿ ( ߰)
+	// PuzzleStarter와 상호작용 (새로 추가)
 	APuzzleStarter* PuzzleStarter = Cast<APuzzleStarter>(TargetActor);
 	if (PuzzleStarter)
 	{
@@ -776,7 +819,7 @@ bool AHamoniaCharacter::HandleInventoryItemInteraction(UItem* Item, AActor* Targ
 		return false;
 	}
 
-	//  Key 
+	// 기존 Key 로직
 	if (Item->Name.Contains("Key"))
 	{
 		AInteractableMechanism* Door = Cast<AInteractableMechanism>(TargetActor);
@@ -790,7 +833,7 @@ bool AHamoniaCharacter::HandleInventoryItemInteraction(UItem* Item, AActor* Targ
 		}
 	}
 
-	//  Tool 
+	// 기존 Tool 로직
 	if (Item->Name.Contains("Tool"))
 	{
 		APedestal* Pedestal = Cast<APedestal>(TargetActor);
@@ -1,7 +1,9 @@
 #include "Character/Unia.h"
 #include "Character/HamoniaCharacter.h"
 #include "Character/UniaWaitSpot.h"
+#include "Character/UniaWaitSpotSubsystem.h"
 #include "Core/DialogueManagerComponent.h"
+#include "Core/LevelTransitionSubsystem.h"
 #include "AI/UniaAIController.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
@@ -10,6 +12,7 @@
 AUnia::AUnia()
 {
 	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 
 	InteractionSphere = CreateDefaultSubobject<USphereComponent>(TEXT("InteractionSphere"));
 	InteractionSphere->SetupAttachment(RootComponent);
@@ -36,6 +39,12 @@ void AUnia::BeginPlay()
 {
 	Super::BeginPlay();
 
+	bHasBlueprintTick = GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(AUnia, ReceiveTick));
+	if (bHasBlueprintTick)
+	{
+		SetActorTickEnabled(true);
+	}
+
 	InteractionSphere->OnComponentBeginOverlap.AddDynamic(this, &AUnia::OnInteractionSphereBeginOverlap);
 	InteractionSphere->OnComponentEndOverlap.AddDynamic(this, &AUnia::OnInteractionSphereEndOverlap);
 
@@ -43,33 +52,37 @@ void AUnia::BeginPlay()
 	InitializeLevelSettings();
 	LoadStateFromGameInstance();
 
-	UWorld* World = GetWorld();
-	if (World)
+	if (ULevelTransitionSubsystem* LevelTransition = ULevelTransitionSubsystem::Get(this))
 	{
-		CurrentLevelName = World->GetMapName();
-		CurrentLevelName.RemoveFromStart(World->StreamingLevelsPrefix);
+		CurrentLevelName = LevelTransition->GetCurrentLevelName();
+		LevelChangedHandle = LevelTransition->OnLevelChanged().AddUObject(this, &AUnia::HandleLevelChanged);
 	}
 
 	bLevelDialogueEnded = false;
 }
 
-void AUnia::Tick(float DeltaTime)
+void AUnia::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::Tick(DeltaTime);
-
-	UWorld* World = GetWorld();
-	if (World)
+	if (ULevelTransitionSubsystem* LevelTransition = ULevelTransitionSubsystem::Get(this))
 	{
-		FString NewLevelName = World->GetMapName();
-		NewLevelName.RemoveFromStart(World->StreamingLevelsPrefix);
-
-		if (NewLevelName != CurrentLevelName && !NewLevelName.IsEmpty())
-		{
-			CurrentLevelName = NewLevelName;
-			ResetLevelDialogueState();
-		}
+		LevelTransition->OnLevelChanged().Remove(LevelChangedHandle);
 	}
 
+	GetWorld()->GetTimerManager().ClearTimer(SpotCheckTimer);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AUnia::HandleLevelChanged(FName NewLevelName, FName OldLevelName)
+{
+	CurrentLevelName = NewLevelName.ToString();
+	ResetLevelDialogueState();
+}
+
+void AUnia::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
 	if (bLookAtPlayer && PlayerPawn && bPlayerInRange)
 	{
 		UpdateLookAtPlayer(DeltaTime);
@@ -274,6 +287,7 @@ bool AUnia::MoveToWaitSpot(const FString& SpotID)
 	}
 
 	CurrentTargetSpotID = SpotID;
+	CurrentTargetSpot = WaitSpot;
 	MoveAIToLocation(WaitSpot->GetWaitLocation());
 
 	GetWorld()->GetTimerManager().SetTimer(SpotCheckTimer, this, &AUnia::CheckSpotArrival, 0.5f, true);
@@ -294,10 +308,9 @@ void AUnia::CheckDialogueForAIAction(const FString& DialogueID)
 		return;
 	}
 
-	if (DialogueToSpotMap.Contains(DialogueID))
+	if (const FString* SpotID = DialogueToSpotMap.Find(DialogueID))
 	{
-		FString SpotID = DialogueToSpotMap[DialogueID];
-		MoveToWaitSpot(SpotID);
+		MoveToWaitSpot(*SpotID);
 	}
 }
 
@@ -332,8 +345,7 @@ void AUnia::SaveStateToGameInstance()
 		return;
 	}
 
-	FString CurrentLevel = GetWorld()->GetMapName();
-	CurrentLevel.RemoveFromStart(GetWorld()->StreamingLevelsPrefix);
+	FString CurrentLevel = ULevelTransitionSubsystem::GetLevelNameFor(this);
 
 	SaveData->SetUniaLocation(CurrentLevel, GetActorLocation(), GetActorRotation());
 	SaveData->UniaData.bCanFollow = bCanFollow;
@@ -354,8 +366,7 @@ void AUnia::LoadStateFromGameInstance()
 		return;
 	}
 
-	FString CurrentLevel = GetWorld()->GetMapName();
-	CurrentLevel.RemoveFromStart(GetWorld()->StreamingLevelsPrefix);
+	FString CurrentLevel = ULevelTransitionSubsystem::GetLevelNameFor(this);
 
 	if (SaveData->UniaData.CurrentLevel == CurrentLevel)
 	{
@@ -422,6 +433,7 @@ void AUnia::OnInteractionSphereBeginOverlap(UPrimitiveComponent* OverlappedCompo
 	if (Player)
 	{
 		bPlayerInRange = true;
+		SetActorTickEnabled(true);
 		Player->SetCurrentInteractableNPC(this);
 		OnPlayerEnterRange(Player);
 	}
@@ -434,6 +446,7 @@ void AUnia::OnInteractionSphereEndOverlap(UPrimitiveComponent* OverlappedCompone
 	if (Player)
 	{
 		bPlayerInRange = false;
+		SetActorTickEnabled(bHasBlueprintTick);
 		Player->RemoveInteractableNPC(this);
 		OnPlayerExitRange(Player);
 	}
@@ -452,9 +465,10 @@ void AUnia::CheckSpotArrival()
 		return;
 	}
 
-	AUniaWaitSpot* WaitSpot = FindWaitSpot(CurrentTargetSpotID);
+	AUniaWaitSpot* WaitSpot = CurrentTargetSpot.Get();
 	if (!WaitSpot)
 	{
+		CurrentTargetSpotID = TEXT("");
 		GetWorld()->GetTimerManager().ClearTimer(SpotCheckTimer);
 		return;
 	}
@@ -463,6 +477,7 @@ void AUnia::CheckSpotArrival()
 	if (Distance <= SpotArrivalThreshold)
 	{
 		CurrentTargetSpotID = TEXT("");
+		CurrentTargetSpot.Reset();
 		GetWorld()->GetTimerManager().ClearTimer(SpotCheckTimer);
 
 		if (AUniaAIController* AIController = GetUniaAIController())
@@ -474,23 +489,11 @@ void AUnia::CheckSpotArrival()
 
 AUniaWaitSpot* AUnia::FindWaitSpot(const FString& SpotID)
 {
-	TArray<AActor*> FoundSpots;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AUniaWaitSpot::StaticClass(), FoundSpots);
-
-	FString CurrentLevel = GetWorld()->GetMapName();
-	CurrentLevel.RemoveFromStart(GetWorld()->StreamingLevelsPrefix);
-
-	for (AActor* Actor : FoundSpots)
+	UUniaWaitSpotSubsystem* Registry = GetWorld()->GetSubsystem<UUniaWaitSpotSubsystem>();
+	if (!Registry)
 	{
-		AUniaWaitSpot* WaitSpot = Cast<AUniaWaitSpot>(Actor);
-		if (WaitSpot && WaitSpot->SpotID == SpotID)
-		{
-			if (WaitSpot->IsValidForLevel(CurrentLevel))
-			{
-				return WaitSpot;
-			}
-		}
+		return nullptr;
 	}
 
-	return nullptr;
+	return Registry->FindWaitSpot(SpotID);
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "Character/UniaWaitSpot.h"
+#include "Character/UniaWaitSpotSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 
 AUniaWaitSpot::AUniaWaitSpot()
@@ -6,6 +7,22 @@ AUniaWaitSpot::AUniaWaitSpot()
     PrimaryActorTick.bCanEverTick = false;
     RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("RootComponent"));
 }
+void AUniaWaitSpot::BeginPlay()
+{
+    Super::BeginPlay();
+    if (UUniaWaitSpotSubsystem* Registry = GetWorld()->GetSubsystem<UUniaWaitSpotSubsystem>())
+    {
+        Registry->RegisterWaitSpot(this);
+    }
+}
+void AUniaWaitSpot::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UUniaWaitSpotSubsystem* Registry = GetWorld()->GetSubsystem<UUniaWaitSpotSubsystem>())
+    {
+        Registry->UnregisterWaitSpot(this);
+    }
+    Super::EndPlay(EndPlayReason);
+}
 FVector AUniaWaitSpot::GetWaitLocation() const
 {
     return GetActorLocation();
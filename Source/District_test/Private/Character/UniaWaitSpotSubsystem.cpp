@@ -0,0 +1,124 @@
+#include "Character/UniaWaitSpotSubsystem.h"
+#include "Character/UniaWaitSpot.h"
+#include "Core/LevelTransitionSubsystem.h"
+#include "Engine/World.h"
+
+void UUniaWaitSpotSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    if (ULevelTransitionSubsystem* LevelTransition = InWorld.GetSubsystem<ULevelTransitionSubsystem>())
+    {
+        LevelChangedHandle = LevelTransition->OnLevelChanged().AddUObject(this, &UUniaWaitSpotSubsystem::HandleLevelChanged);
+    }
+}
+
+void UUniaWaitSpotSubsystem::Deinitialize()
+{
+    if (ULevelTransitionSubsystem* LevelTransition = ULevelTransitionSubsystem::Get(this))
+    {
+        LevelTransition->OnLevelChanged().Remove(LevelChangedHandle);
+    }
+
+    SpotsByID.Empty();
+    ResolvedSpots.Empty();
+    RegisteredSpotIDs.Empty();
+    Super::Deinitialize();
+}
+
+void UUniaWaitSpotSubsystem::RegisterWaitSpot(AUniaWaitSpot* WaitSpot)
+{
+    if (!WaitSpot)
+    {
+        return;
+    }
+
+    // Re-registering after a SpotID change moves the spot to its new key
+    if (const FString* RegisteredID = RegisteredSpotIDs.Find(WaitSpot))
+    {
+        if (*RegisteredID == WaitSpot->SpotID)
+        {
+            return;
+        }
+
+        UnregisterWaitSpot(WaitSpot);
+    }
+
+    SpotsByID.FindOrAdd(WaitSpot->SpotID).Add(WaitSpot);
+    RegisteredSpotIDs.Add(WaitSpot, WaitSpot->SpotID);
+
+    ResolvedSpots.Reset();
+}
+
+void UUniaWaitSpotSubsystem::UnregisterWaitSpot(AUniaWaitSpot* WaitSpot)
+{
+    if (!WaitSpot)
+    {
+        return;
+    }
+
+    FString RegisteredID;
+    if (!RegisteredSpotIDs.RemoveAndCopyValue(WaitSpot, RegisteredID))
+    {
+        return;
+    }
+
+    if (TArray<TWeakObjectPtr<AUniaWaitSpot>>* Spots = SpotsByID.Find(RegisteredID))
+    {
+        Spots->Remove(WaitSpot);
+        if (Spots->Num() == 0)
+        {
+            SpotsByID.Remove(RegisteredID);
+        }
+    }
+
+    ResolvedSpots.Reset();
+}
+
+AUniaWaitSpot* UUniaWaitSpotSubsystem::FindWaitSpot(const FString& SpotID)
+{
+    ULevelTransitionSubsystem* LevelTransition = ULevelTransitionSubsystem::Get(this);
+    const FName LevelKey = LevelTransition ? LevelTransition->GetCurrentLevelFName() : NAME_None;
+    const TPair<FName, FString> Key(LevelKey, SpotID);
+
+    if (const TWeakObjectPtr<AUniaWaitSpot>* Resolved = ResolvedSpots.Find(Key))
+    {
+        if (AUniaWaitSpot* WaitSpot = Resolved->Get())
+        {
+            return WaitSpot;
+        }
+    }
+
+    const FString CurrentLevel = LevelTransition ? LevelTransition->GetCurrentLevelName() : FString();
+
+    AUniaWaitSpot* Found = nullptr;
+    if (const TArray<TWeakObjectPtr<AUniaWaitSpot>>* Spots = SpotsByID.Find(SpotID))
+    {
+        for (const TWeakObjectPtr<AUniaWaitSpot>& SpotPtr : *Spots)
+        {
+            AUniaWaitSpot* WaitSpot = SpotPtr.Get();
+            if (WaitSpot && WaitSpot->IsValidForLevel(CurrentLevel))
+            {
+                Found = WaitSpot;
+                break;
+            }
+        }
+    }
+
+    if (Found)
+    {
+        ResolvedSpots.Add(Key, Found);
+    }
+
+    return Found;
+}
+
+FString UUniaWaitSpotSubsystem::GetCurrentLevelName() const
+{
+    return ULevelTransitionSubsystem::GetLevelNameFor(this);
+}
+
+void UUniaWaitSpotSubsystem::HandleLevelChanged(FName NewLevelName, FName OldLevelName)
+{
+    ResolvedSpots.Reset();
+}
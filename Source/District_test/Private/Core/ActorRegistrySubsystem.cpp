@@ -0,0 +1,113 @@
+#include "Core/ActorRegistrySubsystem.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+
+void UActorRegistrySubsystem::Deinitialize()
+{
+    ActorsByClass.Empty();
+    Super::Deinitialize();
+}
+
+UActorRegistrySubsystem* UActorRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    return World ? World->GetSubsystem<UActorRegistrySubsystem>() : nullptr;
+}
+
+void UActorRegistrySubsystem::AddActor(AActor* Actor)
+{
+    if (Actor && !Actor->IsTemplate())
+    {
+        if (UActorRegistrySubsystem* Registry = Get(Actor))
+        {
+            Registry->RegisterActor(Actor);
+        }
+    }
+}
+
+void UActorRegistrySubsystem::RemoveActor(AActor* Actor)
+{
+    if (Actor && !Actor->IsTemplate())
+    {
+        if (UActorRegistrySubsystem* Registry = Get(Actor))
+        {
+            Registry->UnregisterActor(Actor);
+        }
+    }
+}
+
+void UActorRegistrySubsystem::RegisterActor(AActor* Actor)
+{
+    if (!IsValid(Actor))
+    {
+        return;
+    }
+
+    const TWeakObjectPtr<AActor> WeakActor(Actor);
+    for (UClass* Class = Actor->GetClass(); Class && Class != AActor::StaticClass(); Class = Class->GetSuperClass())
+    {
+        ActorsByClass.FindOrAdd(Class).Add(WeakActor);
+    }
+}
+
+void UActorRegistrySubsystem::UnregisterActor(AActor* Actor)
+{
+    if (!Actor)
+    {
+        return;
+    }
+
+    const TWeakObjectPtr<AActor> WeakActor(Actor);
+    for (UClass* Class = Actor->GetClass(); Class && Class != AActor::StaticClass(); Class = Class->GetSuperClass())
+    {
+        if (TSet<TWeakObjectPtr<AActor>>* Actors = ActorsByClass.Find(Class))
+        {
+            Actors->Remove(WeakActor);
+            if (Actors->Num() == 0)
+            {
+                ActorsByClass.Remove(Class);
+            }
+        }
+    }
+}
+
+void UActorRegistrySubsystem::GetRegisteredActors(TSubclassOf<AActor> ActorClass, FName Tag, AActor* Owner, TArray<AActor*>& OutActors) const
+{
+    OutActors.Reset();
+
+    const TSet<TWeakObjectPtr<AActor>>* Actors = ActorClass ? ActorsByClass.Find(ActorClass.Get()) : nullptr;
+    if (!Actors)
+    {
+        return;
+    }
+
+    for (const TWeakObjectPtr<AActor>& WeakActor : *Actors)
+    {
+        AActor* Actor = WeakActor.Get();
+        if (IsValid(Actor) && MatchesFilter(Actor, Tag, Owner))
+        {
+            OutActors.Add(Actor);
+        }
+    }
+}
+
+int32 UActorRegistrySubsystem::GetRegisteredActorCount(TSubclassOf<AActor> ActorClass) const
+{
+    const TSet<TWeakObjectPtr<AActor>>* Actors = ActorClass ? ActorsByClass.Find(ActorClass.Get()) : nullptr;
+    return Actors ? Actors->Num() : 0;
+}
+
+bool UActorRegistrySubsystem::MatchesFilter(const AActor* Actor, FName Tag, const AActor* Owner)
+{
+    if (Tag != NAME_None && !Actor->ActorHasTag(Tag))
+    {
+        return false;
+    }
+
+    if (Owner && Actor->GetOwner() != Owner)
+    {
+        return false;
+    }
+
+    return true;
+}
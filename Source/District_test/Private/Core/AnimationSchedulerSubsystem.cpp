@@ -0,0 +1,164 @@
+#include "Core/AnimationSchedulerSubsystem.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+
+void UAnimationSchedulerSubsystem::Deinitialize()
+{
+    Animations.Empty();
+    PendingAnimations.Empty();
+    Super::Deinitialize();
+}
+
+TStatId UAnimationSchedulerSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UAnimationSchedulerSubsystem, STATGROUP_Tickables);
+}
+
+bool UAnimationSchedulerSubsystem::IsTickable() const
+{
+    return Animations.Num() > 0 || PendingAnimations.Num() > 0;
+}
+
+UAnimationSchedulerSubsystem* UAnimationSchedulerSubsystem::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    return World ? World->GetSubsystem<UAnimationSchedulerSubsystem>() : nullptr;
+}
+
+int32 UAnimationSchedulerSubsystem::StartBlink(UObject* Owner, float Speed, float Duration, FApplyFunc Apply, FFinishedFunc OnFinished)
+{
+    return AddAnimation(EAnimationKind::Blink, Owner, Speed, Duration, MoveTemp(Apply), MoveTemp(OnFinished));
+}
+
+int32 UAnimationSchedulerSubsystem::StartCountdown(UObject* Owner, float Duration, FApplyFunc Apply, FFinishedFunc OnFinished)
+{
+    return AddAnimation(EAnimationKind::Countdown, Owner, 0.0f, Duration, MoveTemp(Apply), MoveTemp(OnFinished));
+}
+
+int32 UAnimationSchedulerSubsystem::AddAnimation(EAnimationKind Kind, UObject* Owner, float Speed, float Duration, FApplyFunc&& Apply, FFinishedFunc&& OnFinished)
+{
+    if (!Owner || !Apply)
+    {
+        return INDEX_NONE;
+    }
+
+    FScheduledAnimation Animation;
+    Animation.Handle = NextHandle++;
+    Animation.Kind = Kind;
+    Animation.Owner = Owner;
+    Animation.Duration = Duration;
+    Animation.Speed = Speed;
+    Animation.Apply = MoveTemp(Apply);
+    Animation.OnFinished = MoveTemp(OnFinished);
+
+    const int32 Handle = Animation.Handle;
+    (bIsTicking ? PendingAnimations : Animations).Add(MoveTemp(Animation));
+    return Handle;
+}
+
+void UAnimationSchedulerSubsystem::Stop(int32& Handle)
+{
+    if (Handle == INDEX_NONE)
+    {
+        return;
+    }
+
+    for (FScheduledAnimation& Animation : Animations)
+    {
+        if (Animation.Handle == Handle)
+        {
+            Animation.bStopped = true;
+        }
+    }
+
+    for (FScheduledAnimation& Animation : PendingAnimations)
+    {
+        if (Animation.Handle == Handle)
+        {
+            Animation.bStopped = true;
+        }
+    }
+
+    Handle = INDEX_NONE;
+}
+
+bool UAnimationSchedulerSubsystem::IsRunning(int32 Handle) const
+{
+    if (Handle == INDEX_NONE)
+    {
+        return false;
+    }
+
+    auto Matches = [Handle](const FScheduledAnimation& Animation)
+    {
+        return Animation.Handle == Handle && !Animation.bStopped;
+    };
+
+    return Animations.ContainsByPredicate(Matches) || PendingAnimations.ContainsByPredicate(Matches);
+}
+
+void UAnimationSchedulerSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    bIsTicking = true;
+
+    TArray<FFinishedFunc> Finished;
+
+    for (FScheduledAnimation& Animation : Animations)
+    {
+        if (Animation.bStopped)
+        {
+            continue;
+        }
+
+        if (!Animation.Owner.IsValid())
+        {
+            Animation.bStopped = true;
+            continue;
+        }
+
+        Animation.Elapsed += DeltaTime;
+        const bool bExpired = Animation.Duration > 0.0f && Animation.Elapsed >= Animation.Duration;
+
+        if (Animation.Kind == EAnimationKind::Blink)
+        {
+            if (!bExpired)
+            {
+                Animation.Apply(FMath::Sin(Animation.Elapsed * Animation.Speed * PI) * 0.5f + 0.5f);
+            }
+        }
+        else
+        {
+            Animation.Apply(FMath::Max(0.0f, Animation.Duration - Animation.Elapsed));
+        }
+
+        if (bExpired)
+        {
+            Animation.bStopped = true;
+            if (Animation.OnFinished)
+            {
+                Finished.Add(MoveTemp(Animation.OnFinished));
+            }
+        }
+    }
+
+    bIsTicking = false;
+
+    Animations.RemoveAllSwap([](const FScheduledAnimation& Animation) { return Animation.bStopped; });
+
+    for (FScheduledAnimation& Animation : PendingAnimations)
+    {
+        if (!Animation.bStopped)
+        {
+            Animations.Add(MoveTemp(Animation));
+        }
+    }
+    PendingAnimations.Reset();
+
+    // Callbacks run last so they can freely start or stop animations
+    for (FFinishedFunc& OnFinished : Finished)
+    {
+        OnFinished();
+    }
+}
@@ -1,5 +1,7 @@
 #include "Core/DialogueManagerComponent.h"
 #include "Core/LevelQuestManager.h"
+#include "Core/LevelTransitionSubsystem.h"
+#include "Core/ActorRegistrySubsystem.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
 #include "Save_Instance/Hamoina_GameInstance.h"
@@ -19,6 +21,26 @@ void UDialogueManagerComponent::BeginPlay()
     bIsInDialogue = false;
     bIsLevelEnd = false;
     CurrentDialogueID = "";
+
+    EnsureDialogueIndex();
+}
+
+void UDialogueManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    InvalidateDialogueIndex();
+    Super::EndPlay(EndPlayReason);
+}
+
+void UDialogueManagerComponent::SetDialogueDataTable(UDataTable* NewTable)
+{
+    if (DialogueDataTable == NewTable)
+    {
+        return;
+    }
+
+    DialogueDataTable = NewTable;
+    InvalidateDialogueIndex();
+    EnsureDialogueIndex();
 }
 
 bool UDialogueManagerComponent::StartDialogue(const FString& DialogueID)
@@ -127,7 +149,7 @@ void UDialogueManagerComponent::ProgressDialogue()
 
     if (NextDialogueData->bChainBreak)
     {
-        //  :    
+        // 순서 변경: 먼저 다음 대사 저장
         if (!NextDialogueData->NextDialogueID.IsEmpty())
         {
             SaveLastDialogueID(NextDialogueData->NextDialogueID);
@@ -234,16 +256,17 @@ FString UDialogueManagerComponent::FindDialogueForCurrentLevel()
         return "";
     }
 
-    TArray<FString> LevelDialogues = GetDialoguesForLevel(CurrentLevel, EDialogueCategory::MainStory);
-    for (const FString& DialogueID : LevelDialogues)
+    const TArray<FDialogueData*>* LevelDialogues = FindIndexedDialogues(CurrentLevel, EDialogueCategory::MainStory);
+    if (!LevelDialogues)
+    {
+        return "";
+    }
+
+    for (FDialogueData* DialogueData : *LevelDialogues)
     {
-        FDialogueData* DialogueData = GetDialogueData(DialogueID);
-        if (DialogueData && !DialogueData->bIsLevelEnd)
+        if (!DialogueData->bIsLevelEnd && ValidateSubStepRequirement(*DialogueData))
         {
-            if (CanProgressToDialogue(DialogueID))
-            {
-                return DialogueID;
-            }
+            return DialogueData->DialogueID;
         }
     }
 
@@ -265,11 +288,11 @@ FString UDialogueManagerComponent::GetMacroDialogue(const FString& LevelName, in
         return MacroID;
     }
 
-    TArray<FString> MacroDialogues = GetDialoguesForLevel(LevelName, EDialogueCategory::Macro);
-    if (MacroDialogues.Num() > 0)
+    const TArray<FDialogueData*>* MacroDialogues = FindIndexedDialogues(LevelName, EDialogueCategory::Macro);
+    if (MacroDialogues && MacroDialogues->Num() > 0)
     {
-        int32 Index = CurrentSubStep % MacroDialogues.Num();
-        return MacroDialogues[Index];
+        int32 Index = CurrentSubStep % MacroDialogues->Num();
+        return (*MacroDialogues)[Index]->DialogueID;
     }
 
     return "Unia_Random_001";
@@ -279,22 +302,16 @@ TArray<FString> UDialogueManagerComponent::GetDialoguesForLevel(const FString& L
 {
     TArray<FString> Result;
 
-    if (!DialogueDataTable)
+    const TArray<FDialogueData*>* LevelDialogues = FindIndexedDialogues(LevelName, Category);
+    if (!LevelDialogues)
     {
         return Result;
     }
 
-    TArray<FDialogueData*> AllDialogues;
-    DialogueDataTable->GetAllRows<FDialogueData>("", AllDialogues);
-
-    for (FDialogueData* DialogueData : AllDialogues)
+    Result.Reserve(LevelDialogues->Num());
+    for (const FDialogueData* DialogueData : *LevelDialogues)
     {
-        if (DialogueData &&
-            DialogueData->LevelName == LevelName &&
-            DialogueData->Category == Category)
-        {
-            Result.Add(DialogueData->DialogueID);
-        }
+        Result.Add(DialogueData->DialogueID);
     }
 
     return Result;
@@ -342,15 +359,7 @@ FString UDialogueManagerComponent::GetCurrentLevelName()
         return CachedQuestManager->GetCurrentLevelName();
     }
 
-    UWorld* World = GetWorld();
-    if (World)
-    {
-        FString LevelName = World->GetMapName();
-        LevelName.RemoveFromStart(World->StreamingLevelsPrefix);
-        return LevelName;
-    }
-
-    return "";
+    return ULevelTransitionSubsystem::GetLevelNameFor(this);
 }
 
 FString UDialogueManagerComponent::FindDialogueForQuest(const FString& QuestState)
@@ -381,23 +390,79 @@ bool UDialogueManagerComponent::CheckAllConditions(const FDialogueData& Dialogue
 
 FDialogueData* UDialogueManagerComponent::GetDialogueData(const FString& DialogueID)
 {
+    EnsureDialogueIndex();
+
+    FDialogueData** Found = DialogueIndex.Find(DialogueID);
+    return Found ? *Found : nullptr;
+}
+
+const TArray<FDialogueData*>* UDialogueManagerComponent::FindIndexedDialogues(const FString& LevelName, EDialogueCategory Category)
+{
+    EnsureDialogueIndex();
+
+    return LevelCategoryIndex.Find(TPair<FString, EDialogueCategory>(LevelName, Category));
+}
+
+void UDialogueManagerComponent::EnsureDialogueIndex()
+{
+    // BP/캐릭터에서 DialogueDataTable을 직접 바꿔도 다음 조회 때 재색인
+    if (IndexedTable.Get() != DialogueDataTable)
+    {
+        InvalidateDialogueIndex();
+    }
+
+    if (bDialogueIndexDirty)
+    {
+        BuildDialogueIndex();
+    }
+}
+
+void UDialogueManagerComponent::BuildDialogueIndex()
+{
+    bDialogueIndexDirty = false;
+    IndexedTable = DialogueDataTable;
+
     if (!DialogueDataTable)
     {
-        return nullptr;
+        return;
     }
 
     TArray<FDialogueData*> AllDialogues;
     DialogueDataTable->GetAllRows<FDialogueData>("", AllDialogues);
 
+    DialogueIndex.Reserve(AllDialogues.Num());
+
     for (FDialogueData* DialogueData : AllDialogues)
     {
-        if (DialogueData && DialogueData->DialogueID == DialogueID)
+        if (!DialogueData)
+        {
+            continue;
+        }
+
+        // 중복 ID는 기존 선형 탐색과 동일하게 첫 번째 행 우선
+        if (!DialogueIndex.Contains(DialogueData->DialogueID))
         {
-            return DialogueData;
+            DialogueIndex.Add(DialogueData->DialogueID, DialogueData);
         }
+
+        LevelCategoryIndex.FindOrAdd(TPair<FString, EDialogueCategory>(DialogueData->LevelName, DialogueData->Category)).Add(DialogueData);
     }
 
-    return nullptr;
+    TableChangedHandle = DialogueDataTable->OnDataTableChanged().AddUObject(this, &UDialogueManagerComponent::InvalidateDialogueIndex);
+}
+
+void UDialogueManagerComponent::InvalidateDialogueIndex()
+{
+    if (UDataTable* OldTable = IndexedTable.Get())
+    {
+        OldTable->OnDataTableChanged().Remove(TableChangedHandle);
+    }
+
+    TableChangedHandle.Reset();
+    IndexedTable.Reset();
+    DialogueIndex.Reset();
+    LevelCategoryIndex.Reset();
+    bDialogueIndexDirty = true;
 }
 
 void UDialogueManagerComponent::ProcessDialogue(const FDialogueData& DialogueData)
@@ -419,22 +484,13 @@ void UDialogueManagerComponent::ProcessDialogue(const FDialogueData& DialogueDat
 
 ALevelQuestManager* UDialogueManagerComponent::FindLevelQuestManager()
 {
-    UWorld* World = GetWorld();
-    if (!World)
+    UActorRegistrySubsystem* Registry = UActorRegistrySubsystem::Get(this);
+    if (!Registry)
     {
         return nullptr;
     }
 
-    TArray<AActor*> QuestManagers;
-    UGameplayStatics::GetAllActorsOfClass(World, ALevelQuestManager::StaticClass(), QuestManagers);
-
-    if (QuestManagers.Num() > 0)
-    {
-        ALevelQuestManager* QuestMgr = Cast<ALevelQuestManager>(QuestManagers[0]);
-        return QuestMgr;
-    }
-
-    return nullptr;
+    return Registry->FindFirstActor<ALevelQuestManager>();
 }
 
 bool UDialogueManagerComponent::ValidateSubStepRequirement(const FDialogueData& DialogueData)
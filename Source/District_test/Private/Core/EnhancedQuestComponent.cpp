@@ -1,5 +1,6 @@
 #include "Core/EnhancedQuestComponent.h"
 #include "Core/LevelQuestManager.h"
+#include "Core/ActorRegistrySubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
 
@@ -111,27 +112,13 @@ ALevelQuestManager* UEnhancedQuestComponent::GetQuestManager()
 {
     if (!QuestManager)
     {
-        UWorld* World = GetWorld();
-        if (World)
+        if (UActorRegistrySubsystem* Registry = UActorRegistrySubsystem::Get(this))
         {
-            TArray<AActor*> FoundActors;
-            UGameplayStatics::GetAllActorsOfClassWithTag(World, ALevelQuestManager::StaticClass(),
-                FName("QuestManager"), FoundActors);
-
-            if (FoundActors.Num() > 0)
-            {
-                QuestManager = Cast<ALevelQuestManager>(FoundActors[0]);
-            }
+            QuestManager = Registry->FindFirstActor<ALevelQuestManager>(FName("QuestManager"));
 
             if (!QuestManager)
             {
-                TArray<AActor*> FoundManagers;
-                UGameplayStatics::GetAllActorsOfClass(World, ALevelQuestManager::StaticClass(), FoundManagers);
-
-                if (FoundManagers.Num() > 0)
-                {
-                    QuestManager = Cast<ALevelQuestManager>(FoundManagers[0]);
-                }
+                QuestManager = Registry->FindFirstActor<ALevelQuestManager>();
             }
         }
     }
@@ -157,7 +144,7 @@ void UEnhancedQuestComponent::UpdateQuestInfo()
 {
     if (!bIsQuestRelated)
     {
-        CurrentLevelInfo = " Ʈ Ʈ þϴ.";
+        CurrentLevelInfo = "이 오브젝트는 퀘스트와 관련없습니다.";
         CurrentSubSteps.Empty();
         SelectedStepPreview = "";
         return;
@@ -165,7 +152,7 @@ void UEnhancedQuestComponent::UpdateQuestInfo()
 
     if (!QuestDataTable)
     {
-        CurrentLevelInfo = "Ʈ  ̺  ʾҽϴ.";
+        CurrentLevelInfo = "퀘스트 데이터 테이블이 설정되지 않았습니다.";
         return;
     }
 
@@ -186,13 +173,13 @@ void UEnhancedQuestComponent::UpdateQuestInfo()
         CurrentLevelName = "Unknown";
     }
 
-    // Row Name  ã ( κ)
+    // Row Name으로 직접 찾기 (수정된 부분)
     FName LevelRowName(*CurrentLevelName);
     FLevelInfo* LevelData = QuestDataTable->FindRow<FLevelInfo>(LevelRowName, TEXT(""));
 
     if (LevelData)
     {
-        CurrentLevelInfo = FString::Printf(TEXT(": %s\nǥ: %s\n: %s"),
+        CurrentLevelInfo = FString::Printf(TEXT("레벨: %s\n목표: %s\n설명: %s"),
             *LevelData->LevelName,
             *LevelData->MainObjective,
             *LevelData->Description);
@@ -201,18 +188,18 @@ void UEnhancedQuestComponent::UpdateQuestInfo()
 
         if (QuestStepIndex >= 0 && QuestStepIndex < CurrentSubSteps.Num())
         {
-            SelectedStepPreview = FString::Printf(TEXT(" %d: %s"),
+            SelectedStepPreview = FString::Printf(TEXT("스텝 %d: %s"),
                 QuestStepIndex,
                 *CurrentSubSteps[QuestStepIndex]);
         }
         else
         {
-            SelectedStepPreview = "߸  εԴϴ.";
+            SelectedStepPreview = "잘못된 스텝 인덱스입니다.";
         }
     }
     else
     {
-        CurrentLevelInfo = FString::Printf(TEXT(" '%s' Ʈ  ã  ϴ."), *CurrentLevelName);
+        CurrentLevelInfo = FString::Printf(TEXT("레벨 '%s'의 퀘스트 정보를 찾을 수 없습니다."), *CurrentLevelName);
         CurrentSubSteps.Empty();
         SelectedStepPreview = "";
     }
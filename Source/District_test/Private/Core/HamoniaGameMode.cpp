@@ -1,7 +1,7 @@
 #include "Core/HamoniaGameMode.h"
 #include "Character/HamoniaCharacter.h"
 #include "Core/HamoniaPlayerController.h"
-#include "Core/LevelQuestManager.h" // ߰
+#include "Core/LevelQuestManager.h" // 추가
 #include "GameFramework/PlayerStart.h"
 #include "Kismet/GameplayStatics.h"
 #include "EngineUtils.h"
@@ -11,7 +11,7 @@ AHamoniaGameMode::AHamoniaGameMode()
     DefaultPawnClass = AHamoniaCharacter::StaticClass();
     PlayerControllerClass = AHamoniaPlayerController::StaticClass();
 
-    // Ʈ Ŵ ʱȭ
+    // 퀘스트 매니저 초기화
     QuestManager = nullptr;
 }
 
@@ -20,10 +20,10 @@ void AHamoniaGameMode::StartPlay()
     Super::StartPlay();
     UE_LOG(LogTemp, Display, TEXT("HamoniaGameMode StartPlay"));
 
-    // BP Ʈ Ŵ ϹǷ C++  ڵ ּ ó
+    // BP에서 퀘스트 매니저를 생성하므로 C++ 생성 코드 주석 처리
     UE_LOG(LogTemp, Warning, TEXT("=== Quest Manager will be created by BP ==="));
 
-    // PlayerStart debugging ( ڵ)
+    // PlayerStart debugging (기존 코드)
     for (TActorIterator<APlayerStart> It(GetWorld()); It; ++It)
     {
         APlayerStart* PlayerStart = *It;
@@ -47,7 +47,7 @@ AActor* AHamoniaGameMode::FindPlayerStart_Implementation(AController* Player, co
     return FoundPlayerStart;
 }
 
-// === Ʈ ý Լ ===
+// === 퀘스트 시스템 함수들 ===
 
 void AHamoniaGameMode::CompleteLevel()
 {
@@ -15,7 +15,7 @@ void AHamoniaPlayerController::BeginPlay()
 
     UE_LOG(LogTemp, Display, TEXT("HamoniaPlayerController BeginPlay"));
 
-    //  Է ý 
+    // 향상된 입력 시스템 설정
     if (UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(GetLocalPlayer()))
     {
         UE_LOG(LogTemp, Display, TEXT("Enhanced Input Subsystem Found"));
@@ -1,10 +1,12 @@
 #include "Core/LevelQuestManager.h"
+#include "Core/LevelTransitionSubsystem.h"
+#include "Core/ActorRegistrySubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "Save_Instance/Hamoina_GameInstance.h"
 
 ALevelQuestManager::ALevelQuestManager()
 {
-    PrimaryActorTick.bCanEverTick = true;
+    PrimaryActorTick.bCanEverTick = false;
     CurrentLevel = "Level_Main_0";
 
     static ConstructorHelpers::FObjectFinder<UDataTable> QuestDTObject(TEXT("/Game/Hamonia/H_DataTable/DT_LevelQuest"));
@@ -14,6 +16,18 @@ ALevelQuestManager::ALevelQuestManager()
     }
 }
 
+void ALevelQuestManager::PostRegisterAllComponents()
+{
+    Super::PostRegisterAllComponents();
+    UActorRegistrySubsystem::AddActor(this);
+}
+
+void ALevelQuestManager::PostUnregisterAllComponents()
+{
+    UActorRegistrySubsystem::RemoveActor(this);
+    Super::PostUnregisterAllComponents();
+}
+
 void ALevelQuestManager::BeginPlay()
 {
     Super::BeginPlay();
@@ -22,13 +36,17 @@ void ALevelQuestManager::BeginPlay()
 
     FString LevelToStart;
 
+    ULevelTransitionSubsystem* LevelTransition = ULevelTransitionSubsystem::Get(this);
+    if (LevelTransition)
+    {
+        LevelChangedHandle = LevelTransition->OnLevelChanged().AddUObject(this, &ALevelQuestManager::HandleLevelChanged);
+    }
+
     if (bAutoDetectLevel)
     {
-        UWorld* World = GetWorld();
-        if (World)
+        if (LevelTransition)
         {
-            LevelToStart = World->GetMapName();
-            LevelToStart.RemoveFromStart(World->StreamingLevelsPrefix);
+            LevelToStart = LevelTransition->GetCurrentLevelName();
         }
     }
     else
@@ -43,17 +61,21 @@ void ALevelQuestManager::BeginPlay()
     }
 }
 
-void ALevelQuestManager::Tick(float DeltaTime)
+void ALevelQuestManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    Super::Tick(DeltaTime);
+    if (ULevelTransitionSubsystem* LevelTransition = ULevelTransitionSubsystem::Get(this))
+    {
+        LevelTransition->OnLevelChanged().Remove(LevelChangedHandle);
+    }
 
-    if (!bAutoDetectLevel) return;
+    Super::EndPlay(EndPlayReason);
+}
 
-    UWorld* World = GetWorld();
-    if (!World) return;
+void ALevelQuestManager::HandleLevelChanged(FName NewLevelName, FName OldLevelName)
+{
+    if (!bAutoDetectLevel) return;
 
-    FString CurrentMapName = World->GetMapName();
-    CurrentMapName.RemoveFromStart(World->StreamingLevelsPrefix);
+    FString CurrentMapName = NewLevelName.ToString();
 
     if (CurrentMapName != LastLoadedLevel && !CurrentMapName.IsEmpty())
     {
@@ -238,16 +260,11 @@ void ALevelQuestManager::RefreshForCurrentLevel()
 
     if (bAutoDetectLevel)
     {
-        UWorld* World = GetWorld();
-        if (World)
-        {
-            FString LevelName = World->GetMapName();
-            LevelName.RemoveFromStart(World->StreamingLevelsPrefix);
+        FString LevelName = ULevelTransitionSubsystem::GetLevelNameFor(this);
 
-            if (!LevelName.IsEmpty())
-            {
-                StartLevel(LevelName);
-            }
+        if (!LevelName.IsEmpty())
+        {
+            StartLevel(LevelName);
         }
     }
 }
@@ -0,0 +1,106 @@
+#include "Core/LevelTransitionSubsystem.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+
+void ULevelTransitionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &ULevelTransitionSubsystem::HandleLevelAdded);
+    LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &ULevelTransitionSubsystem::HandleLevelRemoved);
+
+    RefreshLevelName(false);
+}
+
+void ULevelTransitionSubsystem::Deinitialize()
+{
+    FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+    FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+    LevelChangedEvent.Clear();
+
+    Super::Deinitialize();
+}
+
+void ULevelTransitionSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+    RefreshLevelName(true);
+}
+
+FName ULevelTransitionSubsystem::GetCurrentLevelFName()
+{
+    if (!bResolved)
+    {
+        RefreshLevelName(false);
+    }
+    return CurrentLevelFName;
+}
+
+const FString& ULevelTransitionSubsystem::GetCurrentLevelName()
+{
+    if (!bResolved)
+    {
+        RefreshLevelName(false);
+    }
+    return CurrentLevelName;
+}
+
+ULevelTransitionSubsystem* ULevelTransitionSubsystem::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    return World ? World->GetSubsystem<ULevelTransitionSubsystem>() : nullptr;
+}
+
+FString ULevelTransitionSubsystem::GetLevelNameFor(const UObject* WorldContextObject)
+{
+    if (ULevelTransitionSubsystem* LevelTransition = Get(WorldContextObject))
+    {
+        return LevelTransition->GetCurrentLevelName();
+    }
+    return FString();
+}
+
+void ULevelTransitionSubsystem::HandleLevelAdded(ULevel* Level, UWorld* InWorld)
+{
+    if (InWorld == GetWorld())
+    {
+        RefreshLevelName(true);
+    }
+}
+
+void ULevelTransitionSubsystem::HandleLevelRemoved(ULevel* Level, UWorld* InWorld)
+{
+    if (InWorld == GetWorld())
+    {
+        RefreshLevelName(true);
+    }
+}
+
+void ULevelTransitionSubsystem::RefreshLevelName(bool bBroadcast)
+{
+    UWorld* World = GetWorld();
+    if (!World || !World->PersistentLevel)
+    {
+        return;
+    }
+
+    FString NewLevelName = World->GetMapName();
+    NewLevelName.RemoveFromStart(World->StreamingLevelsPrefix);
+
+    bResolved = true;
+
+    if (NewLevelName.IsEmpty() || NewLevelName == CurrentLevelName)
+    {
+        return;
+    }
+
+    const FName OldLevelFName = CurrentLevelFName;
+    CurrentLevelName = NewLevelName;
+    CurrentLevelFName = FName(*CurrentLevelName);
+
+    if (bBroadcast && !OldLevelFName.IsNone())
+    {
+        LevelChangedEvent.Broadcast(CurrentLevelFName, OldLevelFName);
+        OnLevelChangedBP.Broadcast(CurrentLevelFName, OldLevelFName);
+    }
+}
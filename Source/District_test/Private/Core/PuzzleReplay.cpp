@@ -0,0 +1,464 @@
+#include "Core/PuzzleReplay.h"
+#include "Interaction/UStrokeGrid.h"
+#include "Gameplay/GridMazeManager.h"
+#include "Engine/World.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace PuzzleReplay
+{
+    constexpr uint32 Magic = 0x4C505248; // "HRPL"
+    constexpr uint8 Version = 1;
+    constexpr int32 CodeBits = 3;
+
+    // Keeps the shifted delta inside 32 bits; longer pauses are clamped
+    constexpr uint32 MaxDeltaMs = (1u << (32 - CodeBits)) - 1;
+
+    void WriteVarInt(TArray<uint8>& Data, uint32 Value)
+    {
+        while (Value >= 0x80)
+        {
+            Data.Add(uint8(Value | 0x80));
+            Value >>= 7;
+        }
+        Data.Add(uint8(Value));
+    }
+
+    void WriteSigned(TArray<uint8>& Data, int32 Value)
+    {
+        WriteVarInt(Data, (uint32(Value) << 1) ^ uint32(Value >> 31));
+    }
+
+    void WriteUInt32(TArray<uint8>& Data, uint32 Value)
+    {
+        for (int32 i = 0; i < 4; i++)
+        {
+            Data.Add(uint8(Value >> (i * 8)));
+        }
+    }
+
+    struct FReader
+    {
+        TConstArrayView<uint8> Data;
+        int32 Offset = 0;
+        bool bError = false;
+
+        bool AtEnd() const { return Offset >= Data.Num(); }
+
+        uint8 ReadByte()
+        {
+            if (Offset >= Data.Num())
+            {
+                bError = true;
+                return 0;
+            }
+            return Data[Offset++];
+        }
+
+        uint32 ReadVarInt()
+        {
+            uint32 Value = 0;
+            for (int32 Shift = 0; Shift < 35 && !bError; Shift += 7)
+            {
+                const uint8 Byte = ReadByte();
+                Value |= uint32(Byte & 0x7F) << Shift;
+                if (!(Byte & 0x80))
+                {
+                    return Value;
+                }
+            }
+            bError = true;
+            return 0;
+        }
+
+        int32 ReadSigned()
+        {
+            const uint32 Value = ReadVarInt();
+            return int32(Value >> 1) ^ -int32(Value & 1);
+        }
+
+        uint32 ReadUInt32()
+        {
+            uint32 Value = 0;
+            for (int32 i = 0; i < 4; i++)
+            {
+                Value |= uint32(ReadByte()) << (i * 8);
+            }
+            return Value;
+        }
+    };
+
+    uint32 HashPoints(uint32 Hash, const TArray<FIntPoint>& Points)
+    {
+        Hash = HashCombine(Hash, GetTypeHash(Points.Num()));
+        for (const FIntPoint& Point : Points)
+        {
+            Hash = HashCombine(Hash, GetTypeHash(Point));
+        }
+        return Hash;
+    }
+}
+
+void FPuzzleReplayRecorder::Begin(const FPuzzleReplayHeader& Header, double InStartTime)
+{
+    using namespace PuzzleReplay;
+
+    Data.Reset();
+    StartTime = InStartTime;
+    LastTimeMs = 0;
+    LastStep = FIntPoint::ZeroValue;
+    NumEvents = 0;
+    bRecording = true;
+
+    WriteUInt32(Data, Magic);
+    Data.Add(Version);
+    Data.Add(uint8(Header.Source));
+    WriteUInt32(Data, Header.StageHash);
+    WriteVarInt(Data, uint32(FMath::Max(0, Header.GridSize.X)));
+    WriteVarInt(Data, uint32(FMath::Max(0, Header.GridSize.Y)));
+
+    const FTCHARToUTF8 Name(*Header.StageName);
+    WriteVarInt(Data, uint32(Name.Length()));
+    Data.Append(reinterpret_cast<const uint8*>(Name.Get()), Name.Length());
+}
+
+void FPuzzleReplayRecorder::WriteEventCode(EPuzzleReplayEvent Type, double Time)
+{
+    using namespace PuzzleReplay;
+
+    const uint32 TimeMs = uint32(FMath::Max(0.0, (Time - StartTime) * 1000.0));
+    const uint32 DeltaMs = FMath::Min(TimeMs > LastTimeMs ? TimeMs - LastTimeMs : 0u, MaxDeltaMs);
+    LastTimeMs += DeltaMs;
+
+    WriteVarInt(Data, (DeltaMs << CodeBits) | uint32(Type));
+    NumEvents++;
+}
+
+void FPuzzleReplayRecorder::RecordMove(FIntPoint Direction, double Time)
+{
+    RecordEvent(FPuzzleReplay::DirectionToEvent(Direction), Time);
+}
+
+void FPuzzleReplayRecorder::RecordEvent(EPuzzleReplayEvent Type, double Time)
+{
+    if (bRecording && Type != EPuzzleReplayEvent::Step)
+    {
+        WriteEventCode(Type, Time);
+    }
+}
+
+void FPuzzleReplayRecorder::RecordStep(FIntPoint Cell, double Time)
+{
+    if (!bRecording)
+    {
+        return;
+    }
+
+    WriteEventCode(EPuzzleReplayEvent::Step, Time);
+    PuzzleReplay::WriteSigned(Data, Cell.X - LastStep.X);
+    PuzzleReplay::WriteSigned(Data, Cell.Y - LastStep.Y);
+    LastStep = Cell;
+}
+
+bool FPuzzleReplayRecorder::SaveToFile(const FString& FilePath) const
+{
+    return Data.Num() > 0 && FFileHelper::SaveArrayToFile(Data, *FPuzzleReplay::ResolvePath(FilePath));
+}
+
+bool FPuzzleReplay::Parse(TConstArrayView<uint8> Data, FPuzzleReplay& OutReplay, FString& OutError)
+{
+    using namespace PuzzleReplay;
+
+    OutReplay = FPuzzleReplay();
+
+    FReader Reader{ Data };
+
+    if (Reader.ReadUInt32() != Magic || Reader.bError)
+    {
+        OutError = TEXT("Not a puzzle replay");
+        return false;
+    }
+
+    const uint8 FileVersion = Reader.ReadByte();
+    if (FileVersion != Version)
+    {
+        OutError = FString::Printf(TEXT("Unsupported replay version %d"), FileVersion);
+        return false;
+    }
+
+    const uint8 Source = Reader.ReadByte();
+    if (Source > uint8(EPuzzleReplaySource::GridMaze))
+    {
+        OutError = TEXT("Unknown replay source");
+        return false;
+    }
+
+    FPuzzleReplayHeader& Header = OutReplay.Header;
+    Header.Source = EPuzzleReplaySource(Source);
+    Header.StageHash = Reader.ReadUInt32();
+    Header.GridSize.X = int32(Reader.ReadVarInt());
+    Header.GridSize.Y = int32(Reader.ReadVarInt());
+
+    const int32 NameLength = int32(Reader.ReadVarInt());
+    if (Reader.bError || NameLength < 0 || Reader.Offset + NameLength > Data.Num())
+    {
+        OutError = TEXT("Truncated replay header");
+        return false;
+    }
+
+    const auto Name = StringCast<TCHAR>(reinterpret_cast<const UTF8CHAR*>(Data.GetData() + Reader.Offset), NameLength);
+    Header.StageName = FString(Name.Length(), Name.Get());
+    Reader.Offset += NameLength;
+
+    uint32 TimeMs = 0;
+    FIntPoint LastStep = FIntPoint::ZeroValue;
+
+    while (!Reader.AtEnd())
+    {
+        const uint32 Packed = Reader.ReadVarInt();
+
+        FPuzzleReplayEvent& Event = OutReplay.Events.AddDefaulted_GetRef();
+        TimeMs += Packed >> CodeBits;
+        Event.TimeMs = TimeMs;
+        Event.Type = EPuzzleReplayEvent(Packed & ((1u << CodeBits) - 1));
+
+        if (Event.Type == EPuzzleReplayEvent::Step)
+        {
+            LastStep.X += Reader.ReadSigned();
+            LastStep.Y += Reader.ReadSigned();
+            Event.Cell = LastStep;
+        }
+
+        if (Reader.bError)
+        {
+            OutError = FString::Printf(TEXT("Truncated replay after %d events"), OutReplay.Events.Num() - 1);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool FPuzzleReplay::LoadFromFile(const FString& FilePath, FPuzzleReplay& OutReplay, FString& OutError)
+{
+    TArray<uint8> Data;
+    if (!FFileHelper::LoadFileToArray(Data, *ResolvePath(FilePath)))
+    {
+        OutError = FString::Printf(TEXT("Could not read %s"), *ResolvePath(FilePath));
+        return false;
+    }
+
+    return Parse(Data, OutReplay, OutError);
+}
+
+uint32 FPuzzleReplay::HashStage(const FStrokePuzzleData& Puzzle)
+{
+    using namespace PuzzleReplay;
+
+    uint32 Hash = GetTypeHash(Puzzle.GridSize);
+    Hash = HashCombine(Hash, GetTypeHash(Puzzle.StartPosition));
+    Hash = HashCombine(Hash, GetTypeHash(Puzzle.GoalPosition));
+    Hash = HashPoints(Hash, Puzzle.RequiredPoints);
+    Hash = HashPoints(Hash, Puzzle.WallPositions);
+
+    for (const FTeleportPortal& Portal : Puzzle.TeleportPortals)
+    {
+        Hash = HashCombine(Hash, GetTypeHash(Portal.PortalA));
+        Hash = HashCombine(Hash, GetTypeHash(Portal.PortalB));
+    }
+
+    return Hash;
+}
+
+uint32 FPuzzleReplay::HashStage(FIntPoint GridSize, const TArray<FIntPoint>& CorrectPath)
+{
+    return PuzzleReplay::HashPoints(GetTypeHash(GridSize), CorrectPath);
+}
+
+FString FPuzzleReplay::ResolvePath(const FString& FilePath)
+{
+    return FPaths::IsRelative(FilePath) ? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Replays"), FilePath) : FilePath;
+}
+
+EPuzzleReplayEvent FPuzzleReplay::DirectionToEvent(FIntPoint Direction)
+{
+    if (Direction.X < 0) return EPuzzleReplayEvent::MoveUp;
+    if (Direction.X > 0) return EPuzzleReplayEvent::MoveDown;
+    if (Direction.Y < 0) return EPuzzleReplayEvent::MoveLeft;
+    return EPuzzleReplayEvent::MoveRight;
+}
+
+FIntPoint FPuzzleReplay::EventToDirection(EPuzzleReplayEvent Type)
+{
+    switch (Type)
+    {
+    case EPuzzleReplayEvent::MoveUp: return FIntPoint(-1, 0);
+    case EPuzzleReplayEvent::MoveDown: return FIntPoint(1, 0);
+    case EPuzzleReplayEvent::MoveLeft: return FIntPoint(0, -1);
+    case EPuzzleReplayEvent::MoveRight: return FIntPoint(0, 1);
+    default: return FIntPoint::ZeroValue;
+    }
+}
+
+FPuzzleReplayPlayer::FPuzzleReplayPlayer(FPuzzleReplay InReplay)
+    : Replay(MoveTemp(InReplay))
+{
+}
+
+FPuzzleReplayPlayer::~FPuzzleReplayPlayer()
+{
+    Stop();
+}
+
+bool FPuzzleReplayPlayer::Play(UStrokeGrid* InGrid, float Speed, FString& OutError)
+{
+    if (!InGrid || Replay.Header.Source != EPuzzleReplaySource::StrokeGrid)
+    {
+        OutError = TEXT("Replay was not recorded on a stroke grid");
+        return false;
+    }
+
+    if (Replay.Header.StageHash != FPuzzleReplay::HashStage(InGrid->CurrentPuzzle))
+    {
+        OutError = FString::Printf(TEXT("Replay was recorded on a different stage (%s)"), *Replay.Header.StageName);
+        return false;
+    }
+
+    Stop();
+    Grid = InGrid;
+    Maze.Reset();
+    Start(Speed);
+    return true;
+}
+
+bool FPuzzleReplayPlayer::Play(AGridMazeManager* InMaze, float Speed, FString& OutError)
+{
+    if (!InMaze || Replay.Header.Source != EPuzzleReplaySource::GridMaze)
+    {
+        OutError = TEXT("Replay was not recorded on a grid maze");
+        return false;
+    }
+
+    if (Replay.Header.StageHash != FPuzzleReplay::HashStage(FIntPoint(InMaze->GridRows, InMaze->GridColumns), InMaze->CorrectPath))
+    {
+        OutError = FString::Printf(TEXT("Replay was recorded on a different maze (%s)"), *Replay.Header.StageName);
+        return false;
+    }
+
+    if (Speed != 1.0f)
+    {
+        OutError = FString::Printf(TEXT("Grid maze replays only play at speed 1 (requested %.2f)"), Speed);
+        return false;
+    }
+
+    if (!InMaze->GetWorld())
+    {
+        OutError = TEXT("Grid maze is not in a world");
+        return false;
+    }
+
+    Stop();
+    Maze = InMaze;
+    Grid.Reset();
+    MazeStartTime = InMaze->GetClockTime();
+    Start(Speed);
+    return true;
+}
+
+void FPuzzleReplayPlayer::Start(float Speed)
+{
+    PlaybackTimeMs = 0.0;
+    PlaybackSpeed = Speed;
+    NextEvent = 0;
+
+    if (Speed <= 0.0f)
+    {
+        while (Replay.Events.IsValidIndex(NextEvent))
+        {
+            ApplyEvent(Replay.Events[NextEvent++]);
+        }
+        return;
+    }
+
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FPuzzleReplayPlayer::Tick));
+}
+
+void FPuzzleReplayPlayer::Stop()
+{
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+}
+
+bool FPuzzleReplayPlayer::Tick(float DeltaTime)
+{
+    if (!Grid.IsValid() && !Maze.IsValid())
+    {
+        TickerHandle.Reset();
+        return false;
+    }
+
+    // The maze is timed on world time, so its events fall due by world time rather than by this ticker
+    const UWorld* MazeWorld = Maze.IsValid() ? Maze->GetWorld() : nullptr;
+    if (MazeWorld)
+    {
+        PlaybackTimeMs = (MazeWorld->GetTimeSeconds() - MazeStartTime) * 1000.0;
+    }
+    else
+    {
+        PlaybackTimeMs += DeltaTime * 1000.0 * PlaybackSpeed;
+    }
+
+    while (Replay.Events.IsValidIndex(NextEvent) && Replay.Events[NextEvent].TimeMs <= PlaybackTimeMs)
+    {
+        // NextEvent still points at the event while it is applied, so the maze clock stops at its timestamp
+        ApplyEvent(Replay.Events[NextEvent]);
+        NextEvent++;
+    }
+
+    if (!Replay.Events.IsValidIndex(NextEvent))
+    {
+        TickerHandle.Reset();
+        return false;
+    }
+
+    return true;
+}
+
+double FPuzzleReplayPlayer::GetNextMazeEventTime() const
+{
+    return Replay.Events.IsValidIndex(NextEvent) ? MazeStartTime + Replay.Events[NextEvent].TimeMs / 1000.0 : MAX_dbl;
+}
+
+void FPuzzleReplayPlayer::ApplyEvent(const FPuzzleReplayEvent& Event)
+{
+    if (UStrokeGrid* GridPtr = Grid.Get())
+    {
+        switch (Event.Type)
+        {
+        case EPuzzleReplayEvent::Undo:
+            GridPtr->UndoMove();
+            break;
+        case EPuzzleReplayEvent::Redo:
+            GridPtr->RedoMove();
+            break;
+        case EPuzzleReplayEvent::Reset:
+            GridPtr->ResetGame();
+            break;
+        case EPuzzleReplayEvent::Step:
+            break;
+        default:
+            GridPtr->MovePlayer(FPuzzleReplay::EventToDirection(Event.Type));
+            break;
+        }
+    }
+    else if (AGridMazeManager* MazePtr = Maze.Get())
+    {
+        if (Event.Type == EPuzzleReplayEvent::Step)
+        {
+            MazePtr->ApplyReplayStep(Event.Cell);
+        }
+    }
+}
@@ -0,0 +1,104 @@
+#include "Core/StrokeGridLayout.h"
+
+void FStrokeGridLayout::Reset()
+{
+    Size = FIntPoint::ZeroValue;
+    StartIndex = INDEX_NONE;
+    GoalIndex = INDEX_NONE;
+    CellTypes.Reset();
+    Walls.Reset();
+    PortalPartners.Reset();
+    PortalIDs.Reset();
+    RequiredSlots.Reset();
+    NumRequiredSlots = 0;
+}
+
+void FStrokeGridLayout::Build(const FStrokePuzzleData& Puzzle)
+{
+    Reset();
+
+    Size = FIntPoint(FMath::Max(0, Puzzle.GridSize.X), FMath::Max(0, Puzzle.GridSize.Y));
+    const int32 NumCells = Size.X * Size.Y;
+
+    CellTypes.Init(EStrokeCellType::Empty, NumCells);
+    Walls.Init(false, NumCells);
+    PortalPartners.Init(INDEX_NONE, NumCells);
+    PortalIDs.Init(-1, NumCells);
+    RequiredSlots.Init(INDEX_NONE, NumCells);
+
+    StartIndex = ToIndex(Puzzle.StartPosition);
+    GoalIndex = ToIndex(Puzzle.GoalPosition);
+
+    // Same precedence as the old per-query lookup: start, goal, required point, wall
+    for (int32 i = Puzzle.WallPositions.Num() - 1; i >= 0; i--)
+    {
+        const int32 Index = ToIndex(Puzzle.WallPositions[i]);
+        if (Index != INDEX_NONE)
+        {
+            Walls[Index] = true;
+            CellTypes[Index] = EStrokeCellType::Wall;
+        }
+    }
+
+    for (int32 i = Puzzle.RequiredPoints.Num() - 1; i >= 0; i--)
+    {
+        const int32 Index = ToIndex(Puzzle.RequiredPoints[i]);
+        if (Index == INDEX_NONE)
+        {
+            continue;
+        }
+
+        static const EStrokeCellType PointTypes[] = { EStrokeCellType::RedPoint, EStrokeCellType::GreenPoint, EStrokeCellType::BluePoint };
+        CellTypes[Index] = PointTypes[i % 3];
+    }
+
+    for (const FIntPoint& Point : Puzzle.RequiredPoints)
+    {
+        const int32 Index = ToIndex(Point);
+        if (Index != INDEX_NONE && RequiredSlots[Index] == INDEX_NONE)
+        {
+            RequiredSlots[Index] = NumRequiredSlots++;
+        }
+    }
+
+    if (GoalIndex != INDEX_NONE)
+    {
+        CellTypes[GoalIndex] = EStrokeCellType::Goal;
+    }
+
+    if (StartIndex != INDEX_NONE)
+    {
+        CellTypes[StartIndex] = EStrokeCellType::Start;
+    }
+
+    // First portal listing a cell wins, matching the old linear scans
+    for (const FTeleportPortal& Portal : Puzzle.TeleportPortals)
+    {
+        const int32 IndexA = ToIndex(Portal.PortalA);
+        const int32 IndexB = ToIndex(Portal.PortalB);
+
+        if (IndexA != INDEX_NONE)
+        {
+            if (PortalIDs[IndexA] == -1)
+            {
+                PortalIDs[IndexA] = Portal.PortalID;
+            }
+            if (IndexB != INDEX_NONE && PortalPartners[IndexA] == INDEX_NONE)
+            {
+                PortalPartners[IndexA] = IndexB;
+            }
+        }
+
+        if (IndexB != INDEX_NONE)
+        {
+            if (PortalIDs[IndexB] == -1)
+            {
+                PortalIDs[IndexB] = Portal.PortalID;
+            }
+            if (IndexA != INDEX_NONE && PortalPartners[IndexB] == INDEX_NONE)
+            {
+                PortalPartners[IndexB] = IndexA;
+            }
+        }
+    }
+}
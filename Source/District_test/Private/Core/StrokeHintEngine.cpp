@@ -0,0 +1,115 @@
+#include "Core/StrokeHintEngine.h"
+#include "Core/StrokePuzzleSolver.h"
+#include "Async/Async.h"
+
+struct FStrokeHintEngine::FSearchContext
+{
+    std::atomic<bool> bCancel { false };
+    TUniquePtr<FStrokePuzzleSolver> Solver;
+};
+
+FStrokeHintEngine::FStrokeHintEngine(const FStrokePuzzleData& InPuzzle, bool bInEnforceRGBOrder)
+    : bEnforceRGBOrder(bInEnforceRGBOrder)
+{
+    Context = MakeShared<FSearchContext, ESPMode::ThreadSafe>();
+
+    FStrokeSolverSettings Settings;
+    Settings.bEnforceRGBOrder = bEnforceRGBOrder;
+    Settings.MaxSolutions = 1;
+    Settings.MaxStoredSolutions = 1;
+    Settings.MaxNodes = 5000000;
+    Settings.MaxMemoEntries = 1 << 18;
+    Settings.CancelFlag = &Context->bCancel;
+
+    Context->Solver = MakeUnique<FStrokePuzzleSolver>(InPuzzle, Settings);
+}
+
+FStrokeHintEngine::~FStrokeHintEngine()
+{
+    Cancel();
+}
+
+void FStrokeHintEngine::RequestHint(FStrokeHintRequest Request, FOnHintReady OnReady)
+{
+    PendingRequest = MoveTemp(Request);
+    PendingCallback = MoveTemp(OnReady);
+
+    if (bRunning)
+    {
+        // The finished search launches the pending one
+        Context->bCancel = true;
+        return;
+    }
+
+    LaunchPending();
+}
+
+void FStrokeHintEngine::Cancel()
+{
+    PendingRequest.Reset();
+    PendingCallback.Unbind();
+    RunningCallback.Unbind();
+    Context->bCancel = true;
+}
+
+void FStrokeHintEngine::LaunchPending()
+{
+    if (!PendingRequest.IsSet())
+    {
+        return;
+    }
+
+    FStrokeHintRequest Request = MoveTemp(PendingRequest.GetValue());
+    PendingRequest.Reset();
+
+    RunningCallback = MoveTemp(PendingCallback);
+    PendingCallback.Unbind();
+
+    bRunning = true;
+    Context->bCancel = false;
+
+    TWeakPtr<FStrokeHintEngine, ESPMode::ThreadSafe> WeakThis = AsShared();
+    TSharedPtr<FSearchContext, ESPMode::ThreadSafe> SearchContext = Context;
+
+    Async(EAsyncExecution::ThreadPool, [WeakThis, SearchContext, Request = MoveTemp(Request)]() mutable
+    {
+        const FStrokeSolveResult Result = SearchContext->Solver->SolveFrom(Request.Position, Request.VisitedPositions, Request.CollectedPoints);
+
+        EStrokeHintResult HintResult = EStrokeHintResult::Unknown;
+        FIntPoint Direction = FIntPoint::ZeroValue;
+
+        if (Result.bSolvable && Result.Solutions.Num() > 0 && Result.Solutions[0].Num() > 0)
+        {
+            HintResult = EStrokeHintResult::Move;
+            Direction = Result.Solutions[0][0];
+        }
+        else if (Result.bComplete)
+        {
+            HintResult = EStrokeHintResult::DeadEnd;
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Request = MoveTemp(Request), HintResult, Direction]()
+        {
+            if (TSharedPtr<FStrokeHintEngine, ESPMode::ThreadSafe> This = WeakThis.Pin())
+            {
+                This->OnSearchFinished(Request, HintResult, Direction);
+            }
+        });
+    });
+}
+
+void FStrokeHintEngine::OnSearchFinished(const FStrokeHintRequest& Request, EStrokeHintResult Result, FIntPoint Direction)
+{
+    bRunning = false;
+
+    FOnHintReady Callback = MoveTemp(RunningCallback);
+    RunningCallback.Unbind();
+
+    // A newer request superseded this one; its search was cancelled and the answer is stale
+    if (!PendingRequest.IsSet())
+    {
+        Callback.ExecuteIfBound(Result, Direction, Request);
+    }
+
+    LaunchPending();
+}
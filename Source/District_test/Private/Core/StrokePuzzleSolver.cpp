@@ -0,0 +1,385 @@
+#include "Core/StrokePuzzleSolver.h"
+#include "HAL/PlatformTime.h"
+
+const FIntPoint FStrokePuzzleSolver::Directions[4] =
+{
+    FIntPoint(-1, 0),
+    FIntPoint(1, 0),
+    FIntPoint(0, -1),
+    FIntPoint(0, 1)
+};
+
+FStrokePuzzleSolver::FStrokePuzzleSolver(const FStrokePuzzleData& Puzzle, const FStrokeSolverSettings& InSettings)
+    : Settings(InSettings)
+{
+    Layout.Build(Puzzle);
+
+    const int32 NumSlots = Layout.GetNumRequiredSlots();
+    AllCollected = NumSlots >= 64 ? ~uint64(0) : (uint64(1) << NumSlots) - 1;
+
+    if (Layout.Num() == 0)
+    {
+        SetupError = TEXT("Grid is empty");
+    }
+    else if (Layout.Num() > MaxCells)
+    {
+        SetupError = FString::Printf(TEXT("Grid has %d cells, solver supports %d"), Layout.Num(), MaxCells);
+    }
+    else if (NumSlots > MaxRequiredPoints)
+    {
+        SetupError = FString::Printf(TEXT("Puzzle has %d required points, solver supports %d"), NumSlots, MaxRequiredPoints);
+    }
+    else if (Layout.StartIndex == INDEX_NONE || Layout.GoalIndex == INDEX_NONE)
+    {
+        SetupError = TEXT("Start or goal is outside the grid");
+    }
+
+    // A required point sharing a cell with the start or goal is never collected
+    bCanCollectAll = !(Settings.bEnforceRGBOrder && NumSlots < 3);
+    for (int32 Index = 0; Index < Layout.Num() && bCanCollectAll; Index++)
+    {
+        if (Layout.GetRequiredSlot(Index) != INDEX_NONE)
+        {
+            const EStrokeCellType Type = Layout.GetCellType(Index);
+            bCanCollectAll = Type == EStrokeCellType::RedPoint || Type == EStrokeCellType::GreenPoint || Type == EStrokeCellType::BluePoint;
+        }
+    }
+}
+
+FStrokeSolveResult FStrokePuzzleSolver::Solve(const FStrokePuzzleData& Puzzle, const FStrokeSolverSettings& Settings)
+{
+    FStrokePuzzleSolver Solver(Puzzle, Settings);
+
+    FStateKey Start;
+    Start.Cell = Solver.Layout.StartIndex;
+    return Solver.Run(Start);
+}
+
+FStrokeSolveResult FStrokePuzzleSolver::SolveFrom(FIntPoint Position, const TArray<FIntPoint>& VisitedPositions, const TArray<FIntPoint>& CollectedPoints)
+{
+    FStateKey Start;
+
+    if (SetupError.IsEmpty())
+    {
+        Start.Cell = Layout.ToIndex(Position);
+
+        for (const FIntPoint& Visited : VisitedPositions)
+        {
+            const int32 Index = Layout.ToIndex(Visited);
+            if (Index != INDEX_NONE)
+            {
+                Start.Visited.Add(Index);
+            }
+        }
+
+        for (const FIntPoint& Collected : CollectedPoints)
+        {
+            const int32 Index = Layout.ToIndex(Collected);
+            const int32 Slot = Layout.GetRequiredSlot(Index);
+            if (Slot == INDEX_NONE || (Start.Collected & (uint64(1) << Slot)))
+            {
+                continue;
+            }
+
+            Start.Collected |= uint64(1) << Slot;
+
+            if (Settings.bEnforceRGBOrder && Start.Order < OrderComplete)
+            {
+                static const EStrokeCellType ExpectedOrder[] = { EStrokeCellType::RedPoint, EStrokeCellType::GreenPoint, EStrokeCellType::BluePoint };
+                Start.Order = Layout.GetCellType(Index) == ExpectedOrder[Start.Order] ? uint8(Start.Order + 1) : OrderBroken;
+            }
+        }
+    }
+
+    return Run(Start);
+}
+
+FStrokeSolveResult FStrokePuzzleSolver::Run(const FStateKey& Start)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    Result = FStrokeSolveResult();
+    NoProgressChain.Reset();
+    NoProgressChainStart = 0;
+    MoveStack.Reset();
+
+    if (!SetupError.IsEmpty())
+    {
+        Result.Error = SetupError;
+    }
+    else if (Start.Cell == INDEX_NONE)
+    {
+        Result.Error = TEXT("Position is outside the grid");
+    }
+    else if (bCanCollectAll && Start.Order != OrderBroken)
+    {
+        Search(Start);
+    }
+
+    const bool bCancelled = Settings.CancelFlag && Settings.CancelFlag->load(std::memory_order_relaxed);
+
+    Result.bComplete = Result.Error.IsEmpty() && Result.NodesVisited < Settings.MaxNodes && !bCancelled;
+    Result.bCountCapped = Result.SolutionCount >= Settings.MaxSolutions;
+    Result.SolutionCount = FMath::Min(Result.SolutionCount, Settings.MaxSolutions);
+    Result.bSolvable = Result.SolutionCount > 0;
+    Result.SolveTimeSeconds = FPlatformTime::Seconds() - StartTime;
+
+    return Result;
+}
+
+int64 FStrokePuzzleSolver::Search(const FStateKey& Start)
+{
+    SearchStack.Reset();
+
+    int64 StartCount = 0;
+    if (!EnterState(Start, StartCount))
+    {
+        return StartCount;
+    }
+
+    while (true)
+    {
+        FSearchFrame& Frame = SearchStack.Last();
+        bool bDescended = false;
+
+        while (Frame.NextDirection < 4)
+        {
+            const int32 Direction = Frame.NextDirection++;
+
+            FStateKey Next;
+            if (!TryMove(Frame.State, Direction, Next))
+            {
+                continue;
+            }
+
+            MoveStack.Add(Directions[Direction]);
+
+            if (IsWin(Next))
+            {
+                if (Result.Solutions.Num() < Settings.MaxStoredSolutions)
+                {
+                    Result.Solutions.Add(MoveStack);
+                }
+
+                Result.SolutionCount++;
+                Frame.Count++;
+            }
+            else
+            {
+                // Frame is not used again after a push, which may reallocate the stack
+                int64 ChildCount = 0;
+                if (EnterState(Next, ChildCount))
+                {
+                    bDescended = true;
+                    break;
+                }
+
+                Frame.Count += ChildCount;
+            }
+
+            MoveStack.Pop(EAllowShrinking::No);
+
+            if (ShouldStop())
+            {
+                Frame.NextDirection = 4;
+            }
+        }
+
+        if (bDescended)
+        {
+            continue;
+        }
+
+        const int64 Count = LeaveState();
+        if (SearchStack.Num() == 0)
+        {
+            return Count;
+        }
+
+        FSearchFrame& Parent = SearchStack.Last();
+        Parent.Count += Count;
+        MoveStack.Pop(EAllowShrinking::No);
+
+        if (ShouldStop())
+        {
+            Parent.NextDirection = 4;
+        }
+    }
+}
+
+bool FStrokePuzzleSolver::EnterState(const FStateKey& State, int64& OutCount)
+{
+    OutCount = 0;
+
+    if (ShouldStop())
+    {
+        return false;
+    }
+
+    Result.NodesVisited++;
+
+    if (!CanStillFinish(State))
+    {
+        return false;
+    }
+
+    // Leaving the current cell grows the visited set unless it was already stepped off
+    const bool bProgress = !State.Visited.Contains(State.Cell);
+    const int32 SavedChainStart = NoProgressChainStart;
+
+    if (bProgress)
+    {
+        // Positive counts cached by an earlier run carry no move list, so re-search those when one is wanted
+        const int64* Cached = Memo.Find(State);
+        if (Cached && (*Cached == 0 || Result.Solutions.Num() >= Settings.MaxStoredSolutions))
+        {
+            Result.SolutionCount += *Cached;
+            OutCount = *Cached;
+            return false;
+        }
+
+        NoProgressChainStart = NoProgressChain.Num();
+    }
+    else
+    {
+        for (int32 i = NoProgressChainStart; i < NoProgressChain.Num(); i++)
+        {
+            if (NoProgressChain[i] == State)
+            {
+                return false;
+            }
+        }
+
+        NoProgressChain.Add(State);
+    }
+
+    FSearchFrame& Frame = SearchStack.AddDefaulted_GetRef();
+    Frame.State = State;
+    Frame.SavedChainStart = SavedChainStart;
+    Frame.bProgress = bProgress;
+    return true;
+}
+
+int64 FStrokePuzzleSolver::LeaveState()
+{
+    const FSearchFrame Frame = SearchStack.Pop(EAllowShrinking::No);
+
+    if (Frame.bProgress)
+    {
+        NoProgressChainStart = Frame.SavedChainStart;
+
+        // Only fully explored subtrees are reusable
+        if (!ShouldStop() && Memo.Num() < Settings.MaxMemoEntries)
+        {
+            Memo.Add(Frame.State, Frame.Count);
+        }
+    }
+    else
+    {
+        NoProgressChain.Pop(EAllowShrinking::No);
+    }
+
+    return Frame.Count;
+}
+
+bool FStrokePuzzleSolver::TryMove(const FStateKey& State, int32 Direction, FStateKey& OutState) const
+{
+    const int32 NewIndex = Layout.ToIndex(Layout.ToPosition(State.Cell) + Directions[Direction]);
+    if (NewIndex == INDEX_NONE || Layout.IsWall(NewIndex) || State.Visited.Contains(NewIndex))
+    {
+        return false;
+    }
+
+    OutState = State;
+    OutState.Visited.Add(State.Cell);
+
+    const EStrokeCellType Type = Layout.GetCellType(State.Cell);
+    const int32 Slot = Layout.GetRequiredSlot(State.Cell);
+
+    if (Slot != INDEX_NONE && !(OutState.Collected & (uint64(1) << Slot)) &&
+        (Type == EStrokeCellType::RedPoint || Type == EStrokeCellType::GreenPoint || Type == EStrokeCellType::BluePoint))
+    {
+        OutState.Collected |= uint64(1) << Slot;
+
+        if (Settings.bEnforceRGBOrder && OutState.Order < OrderComplete)
+        {
+            static const EStrokeCellType ExpectedOrder[] = { EStrokeCellType::RedPoint, EStrokeCellType::GreenPoint, EStrokeCellType::BluePoint };
+            OutState.Order = Type == ExpectedOrder[OutState.Order] ? uint8(OutState.Order + 1) : OrderBroken;
+        }
+    }
+
+    // The first three points are fixed once collected, so a wrong order can never win
+    if (OutState.Order == OrderBroken)
+    {
+        return false;
+    }
+
+    const int32 Partner = Layout.GetPortalPartner(NewIndex);
+    OutState.Cell = Partner != INDEX_NONE ? Partner : NewIndex;
+
+    return true;
+}
+
+bool FStrokePuzzleSolver::IsWin(const FStateKey& State) const
+{
+    return State.Cell == Layout.GoalIndex &&
+        State.Collected == AllCollected &&
+        (!Settings.bEnforceRGBOrder || State.Order == OrderComplete);
+}
+
+bool FStrokePuzzleSolver::CanStillFinish(const FStateKey& State) const
+{
+    // Flood fill over cells that are still enterable; any later path is a subset of this
+    FVisitedSet Seen;
+    Seen.Add(State.Cell);
+
+    ScratchQueue.Reset();
+    ScratchQueue.Add(State.Cell);
+
+    uint64 Reached = 0;
+    bool bGoalReached = false;
+
+    for (int32 Head = 0; Head < ScratchQueue.Num(); Head++)
+    {
+        const int32 Cell = ScratchQueue[Head];
+
+        if (Cell == Layout.GoalIndex)
+        {
+            bGoalReached = true;
+        }
+
+        const int32 Slot = Layout.GetRequiredSlot(Cell);
+        if (Slot != INDEX_NONE)
+        {
+            Reached |= uint64(1) << Slot;
+        }
+
+        const FIntPoint Position = Layout.ToPosition(Cell);
+        for (const FIntPoint& Direction : Directions)
+        {
+            const int32 NewIndex = Layout.ToIndex(Position + Direction);
+            if (NewIndex == INDEX_NONE || Layout.IsWall(NewIndex) || State.Visited.Contains(NewIndex))
+            {
+                continue;
+            }
+
+            const int32 Partner = Layout.GetPortalPartner(NewIndex);
+            const int32 Arrival = Partner != INDEX_NONE ? Partner : NewIndex;
+
+            if (!Seen.Contains(Arrival))
+            {
+                Seen.Add(Arrival);
+                ScratchQueue.Add(Arrival);
+            }
+        }
+    }
+
+    const uint64 Missing = AllCollected & ~State.Collected;
+    return bGoalReached && (Reached & Missing) == Missing;
+}
+
+bool FStrokePuzzleSolver::ShouldStop() const
+{
+    return Result.NodesVisited >= Settings.MaxNodes || Result.SolutionCount >= Settings.MaxSolutions ||
+        (Settings.CancelFlag && Settings.CancelFlag->load(std::memory_order_relaxed));
+}
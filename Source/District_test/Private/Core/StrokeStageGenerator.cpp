@@ -0,0 +1,340 @@
+#include "Core/StrokeStageGenerator.h"
+#include "Core/StrokeGridLayout.h"
+#include "Core/StrokePuzzleSolver.h"
+#include "Engine/DataTable.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformTime.h"
+
+namespace StrokeStageGenerator
+{
+    const FIntPoint Directions[4] = { FIntPoint(-1, 0), FIntPoint(1, 0), FIntPoint(0, -1), FIntPoint(0, 1) };
+
+    // Cells stepped on by a move sequence, portal entries included
+    void TraceCells(const FStrokeGridLayout& Layout, const TArray<FIntPoint>& Moves, TArray<int32>& OutCells)
+    {
+        OutCells.Reset();
+
+        int32 Cell = Layout.StartIndex;
+        OutCells.Add(Cell);
+
+        for (const FIntPoint& Move : Moves)
+        {
+            Cell = Layout.ToIndex(Layout.ToPosition(Cell) + Move);
+            if (Cell == INDEX_NONE)
+            {
+                return;
+            }
+            OutCells.Add(Cell);
+
+            const int32 Partner = Layout.GetPortalPartner(Cell);
+            if (Partner != INDEX_NONE)
+            {
+                Cell = Partner;
+                OutCells.Add(Cell);
+            }
+        }
+    }
+
+    int32 GetBaseSeed(const FStrokeGeneratorSettings& Settings)
+    {
+        return Settings.Seed != 0 ? Settings.Seed : int32(FPlatformTime::Cycles());
+    }
+}
+
+TArray<FStrokeStageData> FStrokeStageGenerator::Generate(const FStrokeGeneratorSettings& Settings)
+{
+    const int32 StageCount = FMath::Max(0, Settings.StageCount);
+    const int32 BaseSeed = StrokeStageGenerator::GetBaseSeed(Settings);
+
+    TArray<FStrokeStageData> Stages;
+    Stages.SetNum(StageCount);
+
+    TArray<bool> Succeeded;
+    Succeeded.Init(false, StageCount);
+
+    ParallelFor(StageCount, [&](int32 Index)
+    {
+        FRandomStream Random(HashCombine(GetTypeHash(BaseSeed), GetTypeHash(Index)));
+        Succeeded[Index] = GenerateStage(Settings, Random, Stages[Index]);
+    });
+
+    TArray<FStrokeStageData> Result;
+    Result.Reserve(StageCount);
+
+    for (int32 i = 0; i < StageCount; i++)
+    {
+        if (Succeeded[i])
+        {
+            Result.Add(MoveTemp(Stages[i]));
+        }
+    }
+
+    if (Result.Num() < StageCount)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("StrokeStageGenerator: %d of %d stages failed, try a larger grid or lower difficulty"),
+            StageCount - Result.Num(), StageCount);
+    }
+
+    return Result;
+}
+
+bool FStrokeStageGenerator::GenerateStage(const FStrokeGeneratorSettings& Settings, FRandomStream& Random, FStrokeStageData& OutStage)
+{
+    for (int32 Attempt = 0; Attempt < Settings.MaxAttemptsPerStage; Attempt++)
+    {
+        if (TryGenerateStage(Settings, Random, OutStage))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool FStrokeStageGenerator::TryGenerateStage(const FStrokeGeneratorSettings& Settings, FRandomStream& Random, FStrokeStageData& OutStage)
+{
+    using namespace StrokeStageGenerator;
+
+    const FIntPoint GridSize(FMath::Clamp(Settings.GridSize.X, 3, 20), FMath::Clamp(Settings.GridSize.Y, 3, 20));
+    const int32 NumCells = GridSize.X * GridSize.Y;
+
+    const float Coverage = FMath::Lerp(0.35f, 0.85f, (FMath::Clamp(Settings.Difficulty, 1, 10) - 1) / 9.0f);
+    const int32 TargetLength = FMath::Max(6, FMath::RoundToInt(NumCells * Coverage));
+
+    TArray<FIntPoint> Path;
+    if (!BuildRandomWalk(GridSize, TargetLength, Random, Path))
+    {
+        return false;
+    }
+
+    FStrokePuzzleData Puzzle;
+    Puzzle.GridSize = GridSize;
+    Puzzle.StartPosition = Path[0];
+    Puzzle.GoalPosition = Path.Last();
+    Puzzle.RequiredPoints.Reset();
+    Puzzle.WallPositions.Reset();
+    Puzzle.TeleportPortals.Reset();
+
+    // Red, green and blue spread along the walk, so the walk order is also the RGB order
+    const int32 LastIndex = Path.Num() - 1;
+    const int32 Jitter = FMath::Max(0, LastIndex / 12);
+    int32 PreviousIndex = 0;
+
+    for (int32 Point = 1; Point <= 3; Point++)
+    {
+        const int32 Ideal = LastIndex * Point / 4 + Random.RandRange(-Jitter, Jitter);
+        const int32 Index = FMath::Clamp(Ideal, PreviousIndex + 1, LastIndex - 1 - (3 - Point));
+        Puzzle.RequiredPoints.Add(Path[Index]);
+        PreviousIndex = Index;
+    }
+
+    TArray<FIntPoint> IntendedMoves;
+    for (int32 i = 1; i < Path.Num(); i++)
+    {
+        IntendedMoves.Add(Path[i] - Path[i - 1]);
+    }
+
+    // Decoy portals and the base wall fill go on cells the walk does not use
+    TSet<FIntPoint> PathCells;
+    PathCells.Append(Path);
+    TArray<FIntPoint> FreeCells;
+    for (int32 X = 0; X < GridSize.X; X++)
+    {
+        for (int32 Y = 0; Y < GridSize.Y; Y++)
+        {
+            if (!PathCells.Contains(FIntPoint(X, Y)))
+            {
+                FreeCells.Add(FIntPoint(X, Y));
+            }
+        }
+    }
+
+    for (int32 i = FreeCells.Num() - 1; i > 0; i--)
+    {
+        FreeCells.Swap(i, Random.RandRange(0, i));
+    }
+
+    const int32 PortalCount = FMath::Min(FMath::Clamp(Settings.PortalCount, 0, 4), FreeCells.Num() / 2);
+    for (int32 i = 0; i < PortalCount; i++)
+    {
+        FTeleportPortal Portal(i + 1);
+        Portal.PortalA = FreeCells.Pop(EAllowShrinking::No);
+        Portal.PortalB = FreeCells.Pop(EAllowShrinking::No);
+        Puzzle.TeleportPortals.Add(Portal);
+    }
+
+    for (const FIntPoint& Cell : FreeCells)
+    {
+        if (Random.FRand() < Settings.WallDensity)
+        {
+            Puzzle.WallPositions.Add(Cell);
+        }
+    }
+
+    FStrokeSolverSettings SolverSettings;
+    SolverSettings.bEnforceRGBOrder = Settings.bEnforceRGBOrder;
+    SolverSettings.MaxSolutions = 2;
+    SolverSettings.MaxStoredSolutions = 2;
+    SolverSettings.MaxMemoEntries = 0;
+    SolverSettings.MaxNodes = 2000000;
+
+    FStrokeGridLayout Layout;
+    TArray<int32> IntendedCells;
+    TArray<int32> AlternativeCells;
+    TArray<int32> Candidates;
+
+    for (int32 Iteration = 0; Iteration < NumCells * 4; Iteration++)
+    {
+        const FStrokeSolveResult Result = FStrokePuzzleSolver::Solve(Puzzle, SolverSettings);
+        if (!Result.Error.IsEmpty() || !Result.bComplete || !Result.bSolvable)
+        {
+            return false;
+        }
+
+        if (Result.SolutionCount == 1)
+        {
+            // Shortcuts can shrink the walk; reject stages that end up far below the target
+            if (Result.Solutions[0].Num() < TargetLength / 2)
+            {
+                return false;
+            }
+
+            OutStage = FStrokeStageData();
+            OutStage.StageName = FString::Printf(TEXT("Generated %dx%d"), GridSize.X, GridSize.Y);
+            OutStage.GridWidth = GridSize.X;
+            OutStage.GridHeight = GridSize.Y;
+            OutStage.StartPosition = Puzzle.StartPosition;
+            OutStage.GoalPosition = Puzzle.GoalPosition;
+            OutStage.RequiredPoints = Puzzle.RequiredPoints;
+            OutStage.WallPositions = Puzzle.WallPositions;
+            OutStage.TeleportPortals = Puzzle.TeleportPortals;
+            return true;
+        }
+
+        const TArray<FIntPoint>* Alternative = Result.Solutions.FindByPredicate([&IntendedMoves](const TArray<FIntPoint>& Moves)
+        {
+            return Moves != IntendedMoves;
+        });
+
+        if (!Alternative)
+        {
+            return false;
+        }
+
+        Layout.Build(Puzzle);
+        TraceCells(Layout, IntendedMoves, IntendedCells);
+        TraceCells(Layout, *Alternative, AlternativeCells);
+
+        Candidates.Reset();
+        for (int32 Cell : AlternativeCells)
+        {
+            if (!IntendedCells.Contains(Cell) && Layout.GetCellType(Cell) == EStrokeCellType::Empty && Layout.GetPortalID(Cell) == -1)
+            {
+                Candidates.AddUnique(Cell);
+            }
+        }
+
+        if (Candidates.Num() > 0)
+        {
+            Puzzle.WallPositions.Add(Layout.ToPosition(Candidates[Random.RandRange(0, Candidates.Num() - 1)]));
+        }
+        else
+        {
+            // The alternative only uses cells we cannot wall, so keep it as the intended route instead;
+            // the cells it skips become wall candidates on the next pass
+            IntendedMoves = *Alternative;
+        }
+    }
+
+    return false;
+}
+
+bool FStrokeStageGenerator::BuildRandomWalk(FIntPoint GridSize, int32 TargetLength, FRandomStream& Random, TArray<FIntPoint>& OutPath)
+{
+    using namespace StrokeStageGenerator;
+
+    auto IsFree = [&GridSize](const TSet<FIntPoint>& Used, FIntPoint Cell)
+    {
+        return Cell.X >= 0 && Cell.X < GridSize.X && Cell.Y >= 0 && Cell.Y < GridSize.Y && !Used.Contains(Cell);
+    };
+
+    TArray<FIntPoint> Path;
+    TSet<FIntPoint> Used;
+    OutPath.Reset();
+
+    for (int32 Try = 0; Try < 32 && OutPath.Num() < TargetLength; Try++)
+    {
+        Path.Reset();
+        Used.Reset();
+
+        FIntPoint Cell(Random.RandRange(0, GridSize.X - 1), Random.RandRange(0, GridSize.Y - 1));
+        Path.Add(Cell);
+        Used.Add(Cell);
+
+        while (Path.Num() < TargetLength)
+        {
+            FIntPoint Best(-1, -1);
+            int32 BestScore = MAX_int32;
+
+            for (const FIntPoint& Direction : Directions)
+            {
+                const FIntPoint Next = Cell + Direction;
+                if (!IsFree(Used, Next))
+                {
+                    continue;
+                }
+
+                int32 Onward = 0;
+                for (const FIntPoint& NextDirection : Directions)
+                {
+                    Onward += IsFree(Used, Next + NextDirection) ? 1 : 0;
+                }
+
+                // Mostly Warnsdorff (fewest onward moves first) so the walk sweeps the grid, with some noise
+                const int32 Score = Random.FRand() < 0.25f ? Random.RandRange(0, 49) : Onward * 10 + Random.RandRange(0, 9);
+                if (Score < BestScore)
+                {
+                    Best = Next;
+                    BestScore = Score;
+                }
+            }
+
+            if (BestScore == MAX_int32)
+            {
+                break;
+            }
+
+            Cell = Best;
+            Path.Add(Cell);
+            Used.Add(Cell);
+        }
+
+        if (Path.Num() > OutPath.Num())
+        {
+            OutPath = Path;
+        }
+    }
+
+    return OutPath.Num() >= FMath::Max(6, TargetLength * 3 / 4);
+}
+
+void FStrokeStageGenerator::WriteToDataTable(UDataTable* Table, const TArray<FStrokeStageData>& Stages, int32 FirstStageNumber)
+{
+    if (!Table || !Table->GetRowStruct() || !Table->GetRowStruct()->IsChildOf(FStrokeStageData::StaticStruct()))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("StrokeStageGenerator: target table does not use FStrokeStageData rows"));
+        return;
+    }
+
+    for (int32 i = 0; i < Stages.Num(); i++)
+    {
+        const int32 StageNumber = FirstStageNumber + i;
+
+        FStrokeStageData Row = Stages[i];
+        Row.StageName = FString::Printf(TEXT("Stage %d"), StageNumber);
+
+        Table->AddRow(FName(*FString::Printf(TEXT("Stage_%02d"), StageNumber)), Row);
+    }
+
+    Table->MarkPackageDirty();
+}
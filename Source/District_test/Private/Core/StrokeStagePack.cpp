@@ -0,0 +1,399 @@
+#include "Core/StrokeStagePack.h"
+#include "Engine/DataTable.h"
+#include "HAL/PlatformFileManager.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Misc/Paths.h"
+#include "Async/Async.h"
+#include "Algo/BinarySearch.h"
+
+namespace StrokeStagePack
+{
+    constexpr uint32 Magic = 0x4B505348; // "HSPK"
+    constexpr uint16 Version = 1;
+    constexpr int32 HeaderSize = 12;
+    constexpr int32 IndexEntrySize = 12;
+
+    bool FitsInt8(FIntPoint Point)
+    {
+        return Point.X >= MIN_int8 && Point.X <= MAX_int8 && Point.Y >= MIN_int8 && Point.Y <= MAX_int8;
+    }
+
+    void WritePoint(FArchive& Ar, FIntPoint Point)
+    {
+        int8 X = int8(Point.X);
+        int8 Y = int8(Point.Y);
+        Ar << X << Y;
+    }
+
+    FIntPoint ReadPoint(FArchive& Ar)
+    {
+        int8 X = 0;
+        int8 Y = 0;
+        Ar << X << Y;
+        return FIntPoint(X, Y);
+    }
+
+    bool ParseStageNumber(FName RowName, int32& OutNumber)
+    {
+        const FString RowString = RowName.ToString();
+        if (!RowString.StartsWith(TEXT("Stage_")) || !RowString.RightChop(6).IsNumeric())
+        {
+            return false;
+        }
+
+        OutNumber = FCString::Atoi(*RowString.RightChop(6));
+        return true;
+    }
+}
+
+FStrokeStagePack::~FStrokeStagePack() = default;
+
+FString FStrokeStagePack::ResolvePath(const FString& FilePath)
+{
+    return FPaths::IsRelative(FilePath) ? FPaths::Combine(FPaths::ProjectContentDir(), FilePath) : FilePath;
+}
+
+TSharedPtr<FStrokeStagePack, ESPMode::ThreadSafe> FStrokeStagePack::Open(const FString& FilePath)
+{
+    using namespace StrokeStagePack;
+
+    TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*ResolvePath(FilePath)));
+    if (!Handle)
+    {
+        return nullptr;
+    }
+
+    TArray<uint8> Header;
+    Header.SetNumUninitialized(HeaderSize);
+    if (!Handle->Read(Header.GetData(), HeaderSize))
+    {
+        return nullptr;
+    }
+
+    FMemoryReader HeaderReader(Header);
+    uint32 FileMagic = 0;
+    uint16 FileVersion = 0;
+    uint16 Reserved = 0;
+    int32 Count = 0;
+    HeaderReader << FileMagic << FileVersion << Reserved << Count;
+
+    const int64 FileSize = Handle->Size();
+    if (FileMagic != Magic || FileVersion != Version || Count < 0 || HeaderSize + int64(Count) * IndexEntrySize > FileSize)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("StrokeStagePack: %s is not a version %d stage pack"), *FilePath, Version);
+        return nullptr;
+    }
+
+    TArray<uint8> IndexData;
+    IndexData.SetNumUninitialized(Count * IndexEntrySize);
+    if (!Handle->Read(IndexData.GetData(), IndexData.Num()))
+    {
+        return nullptr;
+    }
+
+    TSharedPtr<FStrokeStagePack, ESPMode::ThreadSafe> Pack = MakeShared<FStrokeStagePack, ESPMode::ThreadSafe>();
+    Pack->Index.SetNum(Count);
+
+    FMemoryReader IndexReader(IndexData);
+    for (FIndexEntry& Entry : Pack->Index)
+    {
+        IndexReader << Entry.StageNumber << Entry.Offset << Entry.Size;
+
+        if (int64(Entry.Offset) + Entry.Size > FileSize)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("StrokeStagePack: %s is truncated"), *FilePath);
+            return nullptr;
+        }
+    }
+
+    Pack->File = MoveTemp(Handle);
+    return Pack;
+}
+
+bool FStrokeStagePack::Cook(const UDataTable* Table, TArray<uint8>& OutData, FString& OutError)
+{
+    using namespace StrokeStagePack;
+
+    OutData.Reset();
+
+    if (!Table || !Table->GetRowStruct() || !Table->GetRowStruct()->IsChildOf(FStrokeStageData::StaticStruct()))
+    {
+        OutError = TEXT("Table does not use FStrokeStageData rows");
+        return false;
+    }
+
+    TArray<TPair<int32, const FStrokeStageData*>> Stages;
+
+    for (const TPair<FName, uint8*>& Row : Table->GetRowMap())
+    {
+        int32 StageNumber = 0;
+        if (!ParseStageNumber(Row.Key, StageNumber))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("StrokeStagePack: skipping row %s, not a Stage_NN name"), *Row.Key.ToString());
+            continue;
+        }
+
+        if (Stages.ContainsByPredicate([StageNumber](const TPair<int32, const FStrokeStageData*>& Stage) { return Stage.Key == StageNumber; }))
+        {
+            OutError = FString::Printf(TEXT("Stage %d appears more than once (%s)"), StageNumber, *Row.Key.ToString());
+            return false;
+        }
+
+        const FStrokeStageData* Stage = reinterpret_cast<const FStrokeStageData*>(Row.Value);
+
+        bool bFits = Stage->GridWidth > 0 && Stage->GridWidth <= MAX_int8 && Stage->GridHeight > 0 && Stage->GridHeight <= MAX_int8 &&
+            FitsInt8(Stage->StartPosition) && FitsInt8(Stage->GoalPosition) &&
+            Stage->RequiredPoints.Num() <= MAX_uint16 && Stage->WallPositions.Num() <= MAX_uint16 && Stage->TeleportPortals.Num() <= MAX_uint8;
+
+        for (const FIntPoint& Point : Stage->RequiredPoints) bFits &= FitsInt8(Point);
+        for (const FIntPoint& Point : Stage->WallPositions) bFits &= FitsInt8(Point);
+        for (const FTeleportPortal& Portal : Stage->TeleportPortals) bFits &= FitsInt8(Portal.PortalA) && FitsInt8(Portal.PortalB) && Portal.PortalID >= 0 && Portal.PortalID <= MAX_uint8;
+
+        if (!bFits)
+        {
+            OutError = FString::Printf(TEXT("Stage %d does not fit the pack record layout"), StageNumber);
+            return false;
+        }
+
+        Stages.Emplace(StageNumber, Stage);
+    }
+
+    Stages.Sort([](const TPair<int32, const FStrokeStageData*>& A, const TPair<int32, const FStrokeStageData*>& B)
+    {
+        return A.Key < B.Key;
+    });
+
+    TArray<uint8> Records;
+    TArray<FIndexEntry> Entries;
+    const uint32 RecordsStart = uint32(HeaderSize + Stages.Num() * IndexEntrySize);
+
+    for (const TPair<int32, const FStrokeStageData*>& Stage : Stages)
+    {
+        const int32 RecordStart = Records.Num();
+        EncodeStage(*Stage.Value, Records);
+
+        FIndexEntry& Entry = Entries.AddDefaulted_GetRef();
+        Entry.StageNumber = Stage.Key;
+        Entry.Offset = RecordsStart + uint32(RecordStart);
+        Entry.Size = uint32(Records.Num() - RecordStart);
+    }
+
+    FMemoryWriter Writer(OutData);
+    uint32 FileMagic = Magic;
+    uint16 FileVersion = Version;
+    uint16 Reserved = 0;
+    int32 Count = Entries.Num();
+    Writer << FileMagic << FileVersion << Reserved << Count;
+
+    for (FIndexEntry& Entry : Entries)
+    {
+        Writer << Entry.StageNumber << Entry.Offset << Entry.Size;
+    }
+
+    OutData.Append(Records);
+    return true;
+}
+
+void FStrokeStagePack::EncodeStage(const FStrokeStageData& Stage, TArray<uint8>& OutData)
+{
+    using namespace StrokeStagePack;
+
+    const FTCHARToUTF8 Name(*Stage.StageName);
+
+    FMemoryWriter Writer(OutData);
+    Writer.Seek(OutData.Num());
+
+    uint16 NameBytes = uint16(FMath::Min(Name.Length(), int32(MAX_uint16)));
+    uint8 Width = uint8(Stage.GridWidth);
+    uint8 Height = uint8(Stage.GridHeight);
+    Writer << NameBytes << Width << Height;
+    WritePoint(Writer, Stage.StartPosition);
+    WritePoint(Writer, Stage.GoalPosition);
+
+    uint16 NumRequired = uint16(Stage.RequiredPoints.Num());
+    uint16 NumWalls = uint16(Stage.WallPositions.Num());
+    uint8 NumPortals = uint8(Stage.TeleportPortals.Num());
+    uint8 Reserved = 0;
+    Writer << NumRequired << NumWalls << NumPortals << Reserved;
+
+    OutData.Append(reinterpret_cast<const uint8*>(Name.Get()), NameBytes);
+    Writer.Seek(OutData.Num());
+
+    for (const FIntPoint& Point : Stage.RequiredPoints)
+    {
+        WritePoint(Writer, Point);
+    }
+
+    for (const FIntPoint& Point : Stage.WallPositions)
+    {
+        WritePoint(Writer, Point);
+    }
+
+    for (const FTeleportPortal& Portal : Stage.TeleportPortals)
+    {
+        uint8 PortalID = uint8(Portal.PortalID);
+        Writer << PortalID;
+        WritePoint(Writer, Portal.PortalA);
+        WritePoint(Writer, Portal.PortalB);
+    }
+}
+
+bool FStrokeStagePack::DecodeStage(TConstArrayView<uint8> Data, FStrokeStageData& OutStage)
+{
+    using namespace StrokeStagePack;
+
+    FMemoryReaderView Reader(Data);
+
+    uint16 NameBytes = 0;
+    uint8 Width = 0;
+    uint8 Height = 0;
+    Reader << NameBytes << Width << Height;
+
+    OutStage = FStrokeStageData();
+    OutStage.GridWidth = Width;
+    OutStage.GridHeight = Height;
+    OutStage.StartPosition = ReadPoint(Reader);
+    OutStage.GoalPosition = ReadPoint(Reader);
+
+    uint16 NumRequired = 0;
+    uint16 NumWalls = 0;
+    uint8 NumPortals = 0;
+    uint8 Reserved = 0;
+    Reader << NumRequired << NumWalls << NumPortals << Reserved;
+
+    const int64 NameOffset = Reader.Tell();
+    if (Reader.IsError() || NameOffset + NameBytes + (NumRequired + NumWalls) * 2 + NumPortals * 5 != Data.Num())
+    {
+        return false;
+    }
+
+    const auto Name = StringCast<TCHAR>(reinterpret_cast<const UTF8CHAR*>(Data.GetData() + NameOffset), NameBytes);
+    OutStage.StageName = FString(Name.Length(), Name.Get());
+    Reader.Seek(NameOffset + NameBytes);
+
+    OutStage.RequiredPoints.SetNum(NumRequired);
+    for (FIntPoint& Point : OutStage.RequiredPoints)
+    {
+        Point = ReadPoint(Reader);
+    }
+
+    OutStage.WallPositions.SetNum(NumWalls);
+    for (FIntPoint& Point : OutStage.WallPositions)
+    {
+        Point = ReadPoint(Reader);
+    }
+
+    OutStage.TeleportPortals.SetNum(NumPortals);
+    for (FTeleportPortal& Portal : OutStage.TeleportPortals)
+    {
+        uint8 PortalID = 0;
+        Reader << PortalID;
+        Portal.PortalID = PortalID;
+        Portal.PortalA = ReadPoint(Reader);
+        Portal.PortalB = ReadPoint(Reader);
+    }
+
+    return !Reader.IsError();
+}
+
+const FStrokeStagePack::FIndexEntry* FStrokeStagePack::FindEntry(int32 StageNumber) const
+{
+    const int32 Found = Algo::LowerBoundBy(Index, StageNumber, &FIndexEntry::StageNumber);
+    return Index.IsValidIndex(Found) && Index[Found].StageNumber == StageNumber ? &Index[Found] : nullptr;
+}
+
+bool FStrokeStagePack::ReadStage(const FIndexEntry& Entry, FStrokeStageData& OutStage)
+{
+    TArray<uint8> Record;
+    Record.SetNumUninitialized(Entry.Size);
+
+    {
+        FScopeLock Lock(&FileLock);
+        if (!File || !File->Seek(Entry.Offset) || !File->Read(Record.GetData(), Record.Num()))
+        {
+            return false;
+        }
+    }
+
+    if (!DecodeStage(Record, OutStage))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("StrokeStagePack: stage %d record is corrupt"), Entry.StageNumber);
+        return false;
+    }
+
+    return true;
+}
+
+void FStrokeStagePack::AddToCache(int32 StageNumber, const FStrokeStageData& Stage)
+{
+    FScopeLock Lock(&CacheLock);
+
+    Cache.RemoveAll([StageNumber](const TPair<int32, FStrokeStageData>& Cached) { return Cached.Key == StageNumber; });
+    if (Cache.Num() >= MaxCachedStages)
+    {
+        Cache.RemoveAt(0);
+    }
+    Cache.Emplace(StageNumber, Stage);
+}
+
+bool FStrokeStagePack::LoadStage(int32 StageNumber, FStrokeStageData& OutStage)
+{
+    {
+        FScopeLock Lock(&CacheLock);
+        for (const TPair<int32, FStrokeStageData>& Cached : Cache)
+        {
+            if (Cached.Key == StageNumber)
+            {
+                OutStage = Cached.Value;
+                return true;
+            }
+        }
+    }
+
+    const FIndexEntry* Entry = FindEntry(StageNumber);
+    if (!Entry || !ReadStage(*Entry, OutStage))
+    {
+        return false;
+    }
+
+    AddToCache(StageNumber, OutStage);
+    return true;
+}
+
+void FStrokeStagePack::Prefetch(int32 StageNumber)
+{
+    const FIndexEntry* Entry = FindEntry(StageNumber);
+    if (!Entry)
+    {
+        return;
+    }
+
+    {
+        FScopeLock Lock(&CacheLock);
+        if (PendingPrefetch.Contains(StageNumber) ||
+            Cache.ContainsByPredicate([StageNumber](const TPair<int32, FStrokeStageData>& Cached) { return Cached.Key == StageNumber; }))
+        {
+            return;
+        }
+        PendingPrefetch.Add(StageNumber);
+    }
+
+    Async(EAsyncExecution::ThreadPool, [WeakPack = AsWeak(), EntryCopy = *Entry]()
+    {
+        TSharedPtr<FStrokeStagePack, ESPMode::ThreadSafe> Pack = WeakPack.Pin();
+        if (!Pack)
+        {
+            return;
+        }
+
+        FStrokeStageData Stage;
+        if (Pack->ReadStage(EntryCopy, Stage))
+        {
+            Pack->AddToCache(EntryCopy.StageNumber, Stage);
+        }
+
+        FScopeLock Lock(&Pack->CacheLock);
+        Pack->PendingPrefetch.Remove(EntryCopy.StageNumber);
+    });
+}
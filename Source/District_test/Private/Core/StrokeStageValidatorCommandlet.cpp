@@ -0,0 +1,137 @@
+#include "Core/StrokeStageValidatorCommandlet.h"
+#include "Core/StrokePuzzleSolver.h"
+#include "Core/StrokeGameTypes.h"
+#include "Engine/DataTable.h"
+#include "Async/ParallelFor.h"
+
+namespace StrokeStageValidator
+{
+    const TCHAR* DefaultTables[] =
+    {
+        TEXT("/Game/Hamonia/H_DataTable/DT_StrokeStagesDataTable.DT_StrokeStagesDataTable"),
+        TEXT("/Game/Hamonia/H_DataTable/DT_OneStroke.DT_OneStroke")
+    };
+
+    struct FStageJob
+    {
+        FString TableName;
+        FName RowName;
+        FStrokePuzzleData Puzzle;
+        FStrokeSolveResult Result;
+    };
+
+    void CollectRows(const UDataTable* Table, TArray<FStageJob>& OutJobs)
+    {
+        const UScriptStruct* RowStruct = Table->GetRowStruct();
+        const bool bStageRows = RowStruct && RowStruct->IsChildOf(FStrokeStageData::StaticStruct());
+        const bool bPuzzleRows = RowStruct && RowStruct->IsChildOf(FStrokePuzzleData::StaticStruct());
+
+        if (!bStageRows && !bPuzzleRows)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("StrokeStageValidator: %s does not hold stroke stage rows, skipped"), *Table->GetPathName());
+            return;
+        }
+
+        for (const TPair<FName, uint8*>& Row : Table->GetRowMap())
+        {
+            FStageJob& Job = OutJobs.AddDefaulted_GetRef();
+            Job.TableName = Table->GetName();
+            Job.RowName = Row.Key;
+            Job.Puzzle = bStageRows
+                ? reinterpret_cast<const FStrokeStageData*>(Row.Value)->ToPuzzleData()
+                : *reinterpret_cast<const FStrokePuzzleData*>(Row.Value);
+        }
+    }
+}
+
+UStrokeStageValidatorCommandlet::UStrokeStageValidatorCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = true;
+    LogToConsole = true;
+}
+
+int32 UStrokeStageValidatorCommandlet::Main(const FString& Params)
+{
+    using namespace StrokeStageValidator;
+
+    FStrokeSolverSettings Settings;
+    Settings.bEnforceRGBOrder = FParse::Param(*Params, TEXT("EnforceRGBOrder"));
+    FParse::Value(*Params, TEXT("MaxSolutions="), Settings.MaxSolutions);
+    FParse::Value(*Params, TEXT("MaxNodes="), Settings.MaxNodes);
+
+    TArray<FString> TablePaths;
+    FString TableParam;
+    // Without bShouldStopOnSeparator the value would end at the first comma
+    if (FParse::Value(*Params, TEXT("Table="), TableParam, false))
+    {
+        TableParam.ParseIntoArray(TablePaths, TEXT(","));
+    }
+    else
+    {
+        TablePaths.Append(DefaultTables, UE_ARRAY_COUNT(DefaultTables));
+    }
+
+    TArray<FStageJob> Jobs;
+    for (const FString& TablePath : TablePaths)
+    {
+        if (const UDataTable* Table = LoadObject<UDataTable>(nullptr, *TablePath))
+        {
+            CollectRows(Table, Jobs);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("StrokeStageValidator: could not load %s"), *TablePath);
+        }
+    }
+
+    if (Jobs.Num() == 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("StrokeStageValidator: no stage rows found"));
+        return 1;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    ParallelFor(Jobs.Num(), [&Jobs, &Settings](int32 Index)
+    {
+        Jobs[Index].Result = FStrokePuzzleSolver::Solve(Jobs[Index].Puzzle, Settings);
+    });
+
+    const double TotalTime = FPlatformTime::Seconds() - StartTime;
+
+    int32 NumFailed = 0;
+    for (const FStageJob& Job : Jobs)
+    {
+        const FStrokeSolveResult& Result = Job.Result;
+
+        FString Status;
+        if (!Result.Error.IsEmpty())
+        {
+            Status = FString::Printf(TEXT("ERROR (%s)"), *Result.Error);
+        }
+        else if (Result.bSolvable)
+        {
+            Status = TEXT("OK");
+        }
+        else
+        {
+            Status = Result.bComplete ? TEXT("UNSOLVABLE") : TEXT("UNKNOWN (node budget exhausted)");
+        }
+
+        if (!Result.bSolvable)
+        {
+            NumFailed++;
+        }
+
+        UE_LOG(LogTemp, Display, TEXT("%s.%s: %s, solutions %s%lld, nodes %lld, %.2f ms, first solution %d moves"),
+            *Job.TableName, *Job.RowName.ToString(), *Status,
+            Result.bCountCapped ? TEXT(">=") : TEXT(""), Result.SolutionCount,
+            Result.NodesVisited, Result.SolveTimeSeconds * 1000.0, Result.Solutions.Num() > 0 ? Result.Solutions[0].Num() : 0);
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("StrokeStageValidator: %d rows, %d failed, %.2f s"), Jobs.Num(), NumFailed, TotalTime);
+
+    return NumFailed > 0 ? 1 : 0;
+}
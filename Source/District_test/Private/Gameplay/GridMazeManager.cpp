@@ -2,7 +2,10 @@
 #include "Gameplay/GridMazeManager.h"
 #include "Gameplay/GridTile.h"
 #include "Gameplay/MazeDisplay.h"
+#include "Gameplay/TileLightPoolComponent.h"
+#include "Core/ActorRegistrySubsystem.h"
 #include "Components/StaticMeshComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "Engine/StaticMesh.h"
@@ -33,12 +36,39 @@ AGridMazeManager::AGridMazeManager()
     StartingFloorMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
     StartingFloorMesh->SetCollisionResponseToAllChannels(ECR_Block);
 
+    TileInstances = CreateDefaultSubobject<UInstancedStaticMeshComponent>(TEXT("TileInstances"));
+    TileInstances->SetupAttachment(RootComponent);
+    TileInstances->SetUsingAbsoluteScale(true);
+    TileInstances->SetMobility(EComponentMobility::Movable);
+    TileInstances->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+    TileInstances->SetCollisionResponseToAllChannels(ECR_Block);
+    TileInstances->NumCustomDataFloats = 4;
+
+    if (CubeMeshAsset.Succeeded())
+    {
+        BatchedTileMesh = CubeMeshAsset.Object;
+    }
+
+    LightPool = CreateDefaultSubobject<UTileLightPoolComponent>(TEXT("LightPool"));
+
     FailResetDelay = 3.0f;
     bContinueTimeOnFail = true;
     bKeepProgressOnFail = true;
     SoundVolume = 1.0f;
 }
 
+void AGridMazeManager::PostRegisterAllComponents()
+{
+    Super::PostRegisterAllComponents();
+    UActorRegistrySubsystem::AddActor(this);
+}
+
+void AGridMazeManager::PostUnregisterAllComponents()
+{
+    UActorRegistrySubsystem::RemoveActor(this);
+    Super::PostUnregisterAllComponents();
+}
+
 void AGridMazeManager::BeginPlay()
 {
     Super::BeginPlay();
@@ -55,10 +85,16 @@ void AGridMazeManager::BeginPlay()
         ConnectToDisplay();
     }
 
+    if (bGenerateRandomPath)
+    {
+        GenerateRandomPath();
+    }
+
     ValidateCorrectPath();
 
-    TimeRemaining = PuzzleTimeLimit;
-    SetPuzzleState(EPuzzleState::Ready);
+    SyncSimulationSettings();
+    Simulation.Reset();
+    ProcessSimulationEvents();
 
     SetAllTilesInactive();
 }
@@ -67,16 +103,17 @@ void AGridMazeManager::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
 
-    if ((CurrentState == EPuzzleState::Playing ||
-        (CurrentState == EPuzzleState::Failed && bContinueTimeOnFail)) &&
-        !bGamePaused)
+    CatchUpToClock();
+
+    if (NeedsStepDetection())
     {
-        UpdateTimer(DeltaTime);
+        UpdateBatchedStepDetection();
     }
 }
 
 void AGridMazeManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+    ReplayPlayer.Reset();
     DestroyAllTiles();
     Super::EndPlay(EndPlayReason);
 }
@@ -95,7 +132,7 @@ void AGridMazeManager::OnConstruction(const FTransform& Transform)
     UWorld* World = GetWorld();
     if (!World || World->WorldType != EWorldType::Editor) return;
 
-    if (bShowPreviewInEditor && TileClass && GridRows > 0 && GridColumns > 0)
+    if (bShowPreviewInEditor && (TileClass || bUseBatchedTiles) && GridRows > 0 && GridColumns > 0)
     {
         ClearGridTiles();
         CreateTilesInternal();
@@ -140,6 +177,9 @@ void AGridMazeManager::PostEditChangeProperty(FPropertyChangedEvent& PropertyCha
     if (PropertyName == TEXT("GridRows") ||
         PropertyName == TEXT("GridColumns") ||
         PropertyName == TEXT("TileClass") ||
+        PropertyName == TEXT("bUseBatchedTiles") ||
+        PropertyName == TEXT("BatchedTileMesh") ||
+        PropertyName == TEXT("BatchedTileMaterial") ||
         PropertyName == TEXT("TileSize") ||
         PropertyName == TEXT("TileSpacing") ||
         PropertyName == TEXT("bShowPreviewInEditor"))
@@ -161,7 +201,7 @@ void AGridMazeManager::PostEditChangeProperty(FPropertyChangedEvent& PropertyCha
 }
 #endif
 
-// ============   Լ ============
+// ============ 퍼즐 제어 함수 ============
 
 void AGridMazeManager::StartPuzzle()
 {
@@ -176,16 +216,16 @@ void AGridMazeManager::StartPuzzle()
         return;
     }
 
-    SetPuzzleState(EPuzzleState::Playing);
-    TimeRemaining = PuzzleTimeLimit;
-    CurrentPathIndex = 0;
-    bGamePaused = false;
-    bIsShowingPreview = true;
+    SyncSimulationSettings();
+    AdvanceSimulationClock();
+    Simulation.Start();
+    ProcessSimulationEvents();
 
     SetAllTilesInactive();
 
     if (bEnablePreview)
     {
+        SetPreviewActive(true);
         ShowPathPreviewSequence();
     }
     else
@@ -194,11 +234,7 @@ void AGridMazeManager::StartPuzzle()
         if (CorrectPath.Num() > 0)
         {
             FIntPoint FirstStep = CorrectPath[0];
-            AGridTile* FirstTile = GetTileAt(FirstStep.X, FirstStep.Y);
-            if (FirstTile)
-            {
-                FirstTile->SetTileState(ETileState::FirstStep);
-            }
+            SetTileStateAt(FirstStep.X, FirstStep.Y, ETileState::FirstStep);
         }
     }
 
@@ -220,10 +256,10 @@ void AGridMazeManager::StartPuzzleWithCountdown()
 
 void AGridMazeManager::ResetPuzzle()
 {
-    SetPuzzleState(EPuzzleState::Ready);
-    TimeRemaining = PuzzleTimeLimit;
-    CurrentPathIndex = 0;
-    bGamePaused = false;
+    StopPreview();
+    SyncSimulationSettings();
+    Simulation.Reset();
+    ProcessSimulationEvents();
 
     if (bKeepProgressOnFail)
     {
@@ -240,67 +276,43 @@ void AGridMazeManager::ResetPuzzle()
 
 void AGridMazeManager::CompleteReset()
 {
-    SetPuzzleState(EPuzzleState::Ready);
-    TimeRemaining = PuzzleTimeLimit;
-    CurrentPathIndex = 0;
-    bGamePaused = false;
+    StopPreview();
+    SyncSimulationSettings();
+    Simulation.Reset();
+    ProcessSimulationEvents();
 
     ClearProgressHistory();
     SetAllTilesInactive();
 
+    if (bGenerateRandomPath && bRegeneratePathOnReset)
+    {
+        GenerateRandomPath();
+    }
+
     CustomResetLogic();
 }
 
 void AGridMazeManager::CompletePuzzle()
 {
-    SetPuzzleState(EPuzzleState::Success);
-    PlaySound(SuccessSound);
-
-    if (ConnectedDisplay)
-    {
-        ConnectedDisplay->ShowMessage(TEXT("SUCCESS!"), ConnectedDisplay->SuccessColor); 
-    }
-
-    OnPuzzleCompleted_Event.Broadcast();
-    OnPuzzleCompleted();
+    AdvanceSimulationClock();
+    Simulation.Complete();
+    ProcessSimulationEvents();
 }
 
 void AGridMazeManager::FailPuzzle()
 {
-    SetPuzzleState(EPuzzleState::Failed);
-    PlaySound(FailSound);
-
-    if (ConnectedDisplay)
-    {
-        ConnectedDisplay->ShowMessage(TEXT("TIME OUT!"), ConnectedDisplay->FailedColor);
-    }
-
-    OnPuzzleFailed_Event.Broadcast();
-    OnPuzzleFailed();
-
-    GetWorld()->GetTimerManager().SetTimer(ResetTimer, [this]()
-        {
-            CompleteReset();
-
-            APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
-            if (PlayerPawn)
-            {
-                RespawnPlayerToStart(PlayerPawn);
-            }
-
-            if (ConnectedDisplay)
-            {
-                ConnectedDisplay->ShowMessage(TEXT("READY"), ReadyColor);
-            }
-
-        }, 15.0f, false);
+    AdvanceSimulationClock();
+    Simulation.Fail();
+    ProcessSimulationEvents();
 }
 
 void AGridMazeManager::PausePuzzle()
 {
     if (CurrentState == EPuzzleState::Playing)
     {
-        bGamePaused = true;
+        AdvanceSimulationClock();
+        Simulation.SetPaused(true);
+        ProcessSimulationEvents();
     }
 }
 
@@ -308,21 +320,46 @@ void AGridMazeManager::ResumePuzzle()
 {
     if (CurrentState == EPuzzleState::Playing)
     {
-        bGamePaused = false;
+        AdvanceSimulationClock();
+        Simulation.SetPaused(false);
+        ProcessSimulationEvents();
     }
 }
 
-// ============ Ÿ  ============
+// ============ 타일 관리 ============
 
 void AGridMazeManager::OnTileStep(AGridTile* SteppedTile, AActor* Player)
 {
-    if (!SteppedTile || bIsShowingPreview) return;
+    if (!SteppedTile) return;
 
     FVector2D TilePos = SteppedTile->GetGridPosition();
-    FIntPoint IntTilePos = FIntPoint(TilePos.X, TilePos.Y);
+    HandleStep(FIntPoint(TilePos.X, TilePos.Y), SteppedTile, Player);
+}
+
+void AGridMazeManager::OnCellStep(FIntPoint Cell, AActor* Player)
+{
+    if (!IsValidPosition(Cell.X, Cell.Y)) return;
+
+    HandleStep(Cell, GetTileAt(Cell.X, Cell.Y), Player);
+}
+
+void AGridMazeManager::HandleStep(const FIntPoint& Cell, AGridTile* SteppedTile, AActor* Player)
+{
+    // 리플레이 중에는 기록된 입력만 받음
+    if (IsReplaying() && !bApplyingReplayStep) return;
+
+    // 무시되는 입력도 그대로 기록해야 재생 결과가 같음
+    ReplayRecorder.RecordStep(Cell, GetClockTime());
+
+    // 시계, 대기 중인 리셋, 미리보기를 입력 시각까지 맞춘 뒤 판정
+    CatchUpToClock();
+
+    if (bIsShowingPreview) return;
+
+    LastSteppedCell = Cell;
 
     UE_LOG(LogTemp, Warning, TEXT("=== Tile Stepped ==="));
-    UE_LOG(LogTemp, Warning, TEXT("Stepped: (%d, %d)"), IntTilePos.X, IntTilePos.Y);
+    UE_LOG(LogTemp, Warning, TEXT("Stepped: (%d, %d)"), Cell.X, Cell.Y);
     UE_LOG(LogTemp, Warning, TEXT("CurrentPathIndex: %d"), CurrentPathIndex);
 
     if (CorrectPath.IsValidIndex(CurrentPathIndex))
@@ -340,99 +377,88 @@ void AGridMazeManager::OnTileStep(AGridTile* SteppedTile, AActor* Player)
         return;
     }
 
-    if (CurrentState != EPuzzleState::Playing || bGamePaused)
+    const EMazeStepResult Result = Simulation.Step(Cell);
+    if (Result == EMazeStepResult::Ignored)
     {
         return;
     }
 
-    if (CorrectPath.Num() == 0)
-    {
-        return;
-    }
-
-    bool bIsCorrect = IsCorrectNextStep(IntTilePos.X, IntTilePos.Y);
+    const bool bIsCorrect = Result != EMazeStepResult::Wrong;
     UE_LOG(LogTemp, Warning, TEXT("Result: %s"), bIsCorrect ? TEXT("CORRECT") : TEXT("WRONG"));
 
-    if (bIsCorrect)
-    {
-        SteppedTile->SetTileState(ETileState::Correct);
-        PlaySound(CorrectStepSound);
-
-        MarkStepAsCompleted(IntTilePos);
-        CurrentPathIndex++;
-        OnCorrectStep(SteppedTile);
+    ProcessSimulationEvents(SteppedTile);
 
-        if (ConnectedDisplay)
-        {
-            ConnectedDisplay->UpdateProgress(CurrentPathIndex, CorrectPath.Num());
-        }
+    OnCustomTileStep(SteppedTile, bIsCorrect);
+}
 
-        OnProgressUpdate.Broadcast(CurrentPathIndex);
+AGridTile* AGridMazeManager::GetTileAt(int32 X, int32 Y)
+{
+    if (!IsValidPosition(X, Y)) return nullptr;
+    int32 Index = CellToInstanceIndex(X, Y);
+    return GridTiles.IsValidIndex(Index) ? GridTiles[Index] : nullptr;
+}
 
-        if (CurrentPathIndex < CorrectPath.Num())
-        {
-            FIntPoint NextStep = CorrectPath[CurrentPathIndex];
-            AGridTile* NextTile = GetTileAt(NextStep.X, NextStep.Y);
-            if (NextTile)
-            {
-                NextTile->SetTileState(ETileState::FirstStep);
-            }
-        }
+void AGridMazeManager::SetTileStateAt(int32 X, int32 Y, ETileState NewState)
+{
+    if (!IsValidPosition(X, Y)) return;
 
-        if (CurrentPathIndex >= CorrectPath.Num())
+    if (!bUseBatchedTiles)
+    {
+        if (AGridTile* Tile = GetTileAt(X, Y))
         {
-            CompletePuzzle();
+            Tile->SetTileState(NewState);
         }
+        return;
     }
-    else
+
+    int32 Index = CellToInstanceIndex(X, Y);
+    if (BatchedTileStates.IsValidIndex(Index) && BatchedTileStates[Index] != NewState)
     {
-        SteppedTile->SetTileState(ETileState::Wrong);
-        PlaySound(WrongStepSound);
+        BatchedTileStates[Index] = NewState;
+        UpdateBatchedInstance(Index);
+    }
+}
 
-        if (ConnectedDisplay)
-        {
-            ConnectedDisplay->ShowMessage(TEXT("WRONG!"), FLinearColor::Red);
-        }
+ETileState AGridMazeManager::GetTileStateAt(int32 X, int32 Y) const
+{
+    if (!IsValidPosition(X, Y)) return ETileState::Inactive;
 
-        GetWorld()->GetTimerManager().SetTimer(WrongTileTimer, [this, SteppedTile]()
-            {
-                if (SteppedTile && IsValid(SteppedTile))
-                {
-                    SteppedTile->SetTileState(ETileState::Ready);
-                }
+    int32 Index = CellToInstanceIndex(X, Y);
+    if (bUseBatchedTiles)
+    {
+        return BatchedTileStates.IsValidIndex(Index) ? BatchedTileStates[Index] : ETileState::Inactive;
+    }
 
-                CurrentPathIndex = 0;
+    AGridTile* Tile = GridTiles.IsValidIndex(Index) ? GridTiles[Index] : nullptr;
+    return IsValid(Tile) ? Tile->GetTileState() : ETileState::Inactive;
+}
 
-                SetAllTilesReady();
+bool AGridMazeManager::GetCellAtLocation(const FVector& WorldLocation, FIntPoint& OutCell) const
+{
+    float TotalSize = TileSize + TileSpacing;
+    if (TotalSize <= 0.0f) return false;
 
-                if (CorrectPath.Num() > 0)
-                {
-                    FIntPoint FirstStep = CorrectPath[0];
-                    AGridTile* FirstTile = GetTileAt(FirstStep.X, FirstStep.Y);
-                    if (FirstTile)
-                    {
-                        FirstTile->SetTileState(ETileState::FirstStep);
-                    }
-                }
+    FVector LocalPosition = GetActorRotation().UnrotateVector(WorldLocation - GetActorLocation());
+    if (FMath::Abs(LocalPosition.Z) > BatchedStepHeight) return false;
 
-                if (ConnectedDisplay)
-                {
-                    ConnectedDisplay->ShowMessage(TEXT("TRY AGAIN"), ReadyColor);
-                }
+    float OffsetX = (GridRows - 1) * TotalSize * 0.5f;
+    float OffsetY = (GridColumns - 1) * TotalSize * 0.5f;
 
-            }, 0.5f, false);
+    int32 X = FMath::RoundToInt((LocalPosition.X + OffsetX) / TotalSize);
+    int32 Y = FMath::RoundToInt((LocalPosition.Y + OffsetY) / TotalSize);
+    if (!IsValidPosition(X, Y)) return false;
 
-        OnWrongStep(SteppedTile);
+    // 타일 사이 간격 위는 밟은 것으로 보지 않음
+    FVector CellCenter = CalculateTileLocalPosition(X, Y);
+    float HalfTile = TileSize * 0.5f;
+    if (FMath::Abs(LocalPosition.X - CellCenter.X) > HalfTile ||
+        FMath::Abs(LocalPosition.Y - CellCenter.Y) > HalfTile)
+    {
+        return false;
     }
 
-    OnCustomTileStep(SteppedTile, bIsCorrect);
-}
-
-AGridTile* AGridMazeManager::GetTileAt(int32 X, int32 Y)
-{
-    if (!IsValidPosition(X, Y)) return nullptr;
-    int32 Index = Y * GridColumns + X;
-    return GridTiles.IsValidIndex(Index) ? GridTiles[Index] : nullptr;
+    OutCell = FIntPoint(X, Y);
+    return true;
 }
 
 void AGridMazeManager::CreateGrid()
@@ -447,6 +473,16 @@ void AGridMazeManager::ClearGrid()
 
 void AGridMazeManager::SetAllTilesInactive()
 {
+    if (bUseBatchedTiles)
+    {
+        for (int32 i = 0; i < BatchedTileStates.Num(); i++)
+        {
+            BatchedTileStates[i] = ETileState::Inactive;
+            UpdateBatchedInstance(i);
+        }
+        return;
+    }
+
     for (AGridTile* Tile : GridTiles)
     {
         if (Tile && IsValid(Tile))
@@ -458,6 +494,16 @@ void AGridMazeManager::SetAllTilesInactive()
 
 void AGridMazeManager::SetAllTilesReady()
 {
+    if (bUseBatchedTiles)
+    {
+        for (int32 i = 0; i < BatchedTileStates.Num(); i++)
+        {
+            BatchedTileStates[i] = ETileState::Ready;
+            UpdateBatchedInstance(i);
+        }
+        return;
+    }
+
     for (AGridTile* Tile : GridTiles)
     {
         if (Tile && IsValid(Tile))
@@ -467,7 +513,7 @@ void AGridMazeManager::SetAllTilesReady()
     }
 }
 
-// ============ ̸  ============
+// ============ 미리보기 제어 ============
 
 void AGridMazeManager::ShowPathPreviewSequence()
 {
@@ -476,81 +522,113 @@ void AGridMazeManager::ShowPathPreviewSequence()
         return;
     }
 
+    PreviewSequencer.SetSpeed(PreviewSpeed);
+    PreviewSequencer.Start(CorrectPath, TileLightDelay, bLoopPreview);
+    PreviewClockTime = GetClockTime();
+
     OnPreviewStarted();
-    ShowNextPreviewTile(0);
+
+    // 첫 타일은 바로 표시
+    UpdatePreviewSequence();
+    UpdateTickEnabled();
 }
 
-void AGridMazeManager::ShowNextPreviewTile(int32 Index)
+void AGridMazeManager::StopPreview()
 {
-    UE_LOG(LogTemp, Warning, TEXT("=== ShowNextPreviewTile: Index=%d ==="), Index);
-
-    if (Index >= CorrectPath.Num())
-    {
-        UE_LOG(LogTemp, Warning, TEXT("Preview Complete! Total shown: %d"), Index);
-
-        GetWorld()->GetTimerManager().SetTimer(PreviewTimerHandle, [this]()
-            {
-                bIsShowingPreview = false;
-                SetAllTilesReady();
+    PreviewSequencer.Stop();
+    SetPreviewActive(false);
+}
 
-                if (CorrectPath.Num() > 0)
-                {
-                    FIntPoint FirstStep = CorrectPath[0];
-                    AGridTile* FirstTile = GetTileAt(FirstStep.X, FirstStep.Y);
-                    if (FirstTile)
-                    {
-                        FirstTile->SetTileState(ETileState::FirstStep);
-                        UE_LOG(LogTemp, Warning, TEXT("First tile set at (%d,%d)"), FirstStep.X, FirstStep.Y);
-                    }
-                }
+void AGridMazeManager::SkipPreview()
+{
+    PreviewSequencer.SkipToEnd();
+}
 
-                if (ConnectedDisplay)
-                {
-                    ConnectedDisplay->ShowMessage(TEXT("START!"), ReadyColor);
-                }
+void AGridMazeManager::UpdatePreviewSequence()
+{
+    // 프레임 시간 대신 퍼즐 시계를 따라야 리플레이에서도 미리보기 종료 시점이 같음
+    const double Now = GetClockTime();
+    const float DeltaTime = float(FMath::Max(0.0, Now - PreviewClockTime));
+    PreviewClockTime = FMath::Max(PreviewClockTime, Now);
 
-                OnPreviewFinished();
+    PreviewSequencer.SetSpeed(PreviewSpeed);
+    PreviewSequencer.SetLooping(bLoopPreview);
+    PreviewSequencer.Advance(DeltaTime);
 
-            }, TileLightDelay, false);
+    TArray<FMazePreviewChange> Changes;
+    PreviewSequencer.ConsumeChanges(Changes, FMath::Max(1, MaxPreviewTilesPerFrame));
+    ApplyPreviewChanges(Changes);
 
-        return;
+    if (PreviewSequencer.IsFinished())
+    {
+        FinishPreview();
     }
+}
 
-    FIntPoint CurrentPoint = CorrectPath[Index];
-    UE_LOG(LogTemp, Warning, TEXT("Correct Path[%d] = (%d, %d)"), Index, CurrentPoint.X, CurrentPoint.Y);
-
-    AGridTile* CurrentTile = GetTileAt(CurrentPoint.X, CurrentPoint.Y);
+void AGridMazeManager::ApplyPreviewChanges(const TArray<FMazePreviewChange>& Changes)
+{
+    bool bInstancesChanged = false;
 
-    if (CurrentTile)
+    for (const FMazePreviewChange& Change : Changes)
     {
-        FVector2D TileGridPos = CurrentTile->GetGridPosition();
-        UE_LOG(LogTemp, Warning, TEXT("Tile found! Grid Position: (%.0f, %.0f)"), TileGridPos.X, TileGridPos.Y);
+        const ETileState NewState = Change.bLit ? ETileState::Preview : ETileState::Inactive;
 
-        CurrentTile->SetTileState(ETileState::Preview);
+        if (bUseBatchedTiles)
+        {
+            // 렌더 상태 갱신은 묶음 끝에서 한 번만
+            int32 Index = CellToInstanceIndex(Change.Cell.X, Change.Cell.Y);
+            if (IsValidPosition(Change.Cell.X, Change.Cell.Y) && BatchedTileStates.IsValidIndex(Index) &&
+                BatchedTileStates[Index] != NewState)
+            {
+                BatchedTileStates[Index] = NewState;
+                UpdateBatchedInstance(Index, false);
+                bInstancesChanged = true;
+            }
+            continue;
+        }
 
-        if (Index == 0)
+        AGridTile* Tile = GetTileAt(Change.Cell.X, Change.Cell.Y);
+        if (!Tile)
         {
-            CurrentTile->SetLightIntensity(CurrentTile->PreviewLightIntensity * 1.5f);
+            UE_LOG(LogTemp, Error, TEXT("ERROR: Tile NOT FOUND at (%d, %d)!"), Change.Cell.X, Change.Cell.Y);
+            continue;
+        }
+
+        Tile->SetTileState(NewState);
+
+        if (Change.bLit && Change.PathIndex == 0)
+        {
+            Tile->SetLightIntensity(Tile->PreviewLightIntensity * 1.5f);
         }
     }
-    else
+
+    if (bInstancesChanged && TileInstances)
     {
-        UE_LOG(LogTemp, Error, TEXT("ERROR: Tile NOT FOUND at (%d, %d)!"), CurrentPoint.X, CurrentPoint.Y);
+        TileInstances->MarkRenderStateDirty();
     }
-
-    GetWorld()->GetTimerManager().SetTimer(PreviewTimerHandle, [this, Index]()
-        {
-            ShowNextPreviewTile(Index + 1);
-        }, TileLightDelay, false);
 }
 
-void AGridMazeManager::StopPreview()
+void AGridMazeManager::FinishPreview()
 {
-    bIsShowingPreview = false;
-    GetWorld()->GetTimerManager().ClearTimer(PreviewTimerHandle);
+    PreviewSequencer.Stop();
+    SetPreviewActive(false);
+    SetAllTilesReady();
+
+    if (CorrectPath.Num() > 0)
+    {
+        FIntPoint FirstStep = CorrectPath[0];
+        SetTileStateAt(FirstStep.X, FirstStep.Y, ETileState::FirstStep);
+    }
+
+    if (ConnectedDisplay)
+    {
+        ConnectedDisplay->ShowMessage(TEXT("START!"), ReadyColor);
+    }
+
+    OnPreviewFinished();
 }
 
-// ============  ġ  ============
+// ============ 시작 위치 제어 ============
 
 void AGridMazeManager::CreateStartingFloor()
 {
@@ -576,7 +654,7 @@ void AGridMazeManager::CreateStartingFloor()
     else
 #endif
     {
-        StartingFloorMesh->SetVisibility(false);  //  ߿ 
+        StartingFloorMesh->SetVisibility(false);  // 게임 중엔 숨김
     }
 }
 
@@ -610,64 +688,64 @@ void AGridMazeManager::RespawnPlayerToStart(AActor* Player)
     OnPlayerRespawned(Player);
 }
 
-// ============ ൵  ============
+// ============ 진행도 추적 ============
 
 void AGridMazeManager::MarkStepAsCompleted(const FIntPoint& Position)
 {
-    if (!CompletedSteps.Contains(Position))
-    {
-        CompletedSteps.Add(Position);
-    }
+    Simulation.MarkCompleted(Position);
 }
 
 void AGridMazeManager::MarkStepAsFailed(const FIntPoint& Position)
 {
-    if (!FailedSteps.Contains(Position))
-    {
-        FailedSteps.Add(Position);
-    }
+    Simulation.MarkFailed(Position);
 }
 
 bool AGridMazeManager::IsStepCompleted(const FIntPoint& Position) const
 {
-    return CompletedSteps.Contains(Position);
+    return Simulation.IsCompleted(Position);
 }
 
 bool AGridMazeManager::IsStepFailed(const FIntPoint& Position) const
 {
-    return FailedSteps.Contains(Position);
+    return Simulation.IsFailed(Position);
+}
+
+TArray<FIntPoint> AGridMazeManager::GetCompletedSteps() const
+{
+    return Simulation.GetCompletedLog();
+}
+
+TArray<FIntPoint> AGridMazeManager::GetFailedSteps() const
+{
+    return Simulation.GetFailedLog();
 }
 
 void AGridMazeManager::ClearProgressHistory()
 {
-    CompletedSteps.Empty();
-    FailedSteps.Empty();
+    Simulation.ClearProgress();
 }
 
 void AGridMazeManager::RestoreProgressColors()
 {
-    SetAllTilesReady();
-
-    for (const FIntPoint& CompletedPos : CompletedSteps)
+    // 실패 표시가 완료 표시보다 우선, 상태가 달라지는 칸만 갱신
+    for (int32 X = 0; X < GridRows; X++)
     {
-        AGridTile* Tile = GetTileAt(CompletedPos.X, CompletedPos.Y);
-        if (Tile)
+        for (int32 Y = 0; Y < GridColumns; Y++)
         {
-            Tile->SetTileState(ETileState::Correct);
-        }
-    }
+            const FIntPoint Cell(X, Y);
+            const ETileState TargetState = Simulation.IsFailed(Cell) ? ETileState::Wrong
+                : Simulation.IsCompleted(Cell) ? ETileState::Correct
+                : ETileState::Ready;
 
-    for (const FIntPoint& FailedPos : FailedSteps)
-    {
-        AGridTile* Tile = GetTileAt(FailedPos.X, FailedPos.Y);
-        if (Tile)
-        {
-            Tile->SetTileState(ETileState::Wrong);
+            if (GetTileStateAt(X, Y) != TargetState)
+            {
+                SetTileStateAt(X, Y, TargetState);
+            }
         }
     }
 }
 
-// ============   ============
+// ============ 경로 검증 ============
 
 bool AGridMazeManager::ValidateCorrectPath()
 {
@@ -705,7 +783,26 @@ bool AGridMazeManager::ValidateCorrectPath()
     return true;
 }
 
-// ============   ============
+void AGridMazeManager::GenerateRandomPath()
+{
+    const int32 Seed = PathGenerator.Seed != 0
+        ? int32(HashCombine(GetTypeHash(PathGenerator.Seed), GetTypeHash(PathGeneration)))
+        : int32(FPlatformTime::Cycles());
+
+    FRandomStream Random(Seed);
+    PathGeneration++;
+
+    TArray<FIntPoint> NewPath = FMazePathGenerator::Generate(GridRows, GridColumns, PathGenerator, Random);
+    if (NewPath.Num() < 2)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("GenerateRandomPath: grid %dx%d is too small"), GridRows, GridColumns);
+        return;
+    }
+
+    SetCorrectPath(NewPath);
+}
+
+// ============ 설정 변경 ============
 
 void AGridMazeManager::SetGridSize(int32 NewRows, int32 NewColumns)
 {
@@ -729,9 +826,13 @@ void AGridMazeManager::SetTimeLimit(float NewTimeLimit)
     if (NewTimeLimit > 0.0f)
     {
         PuzzleTimeLimit = NewTimeLimit;
+        Simulation.Settings.TimeLimit = NewTimeLimit;
+
         if (CurrentState == EPuzzleState::Ready || CurrentState == EPuzzleState::Playing)
         {
-            TimeRemaining = NewTimeLimit;
+            AdvanceSimulationClock();
+            Simulation.SetTimeRemaining(NewTimeLimit);
+            ProcessSimulationEvents();
         }
     }
 }
@@ -776,7 +877,7 @@ void AGridMazeManager::SetPuzzleColors(FLinearColor Inactive, FLinearColor Ready
     ApplyTileColors();
 }
 
-// ============  ȸ ============
+// ============ 정보 조회 ============
 
 float AGridMazeManager::GetProgress() const
 {
@@ -802,7 +903,83 @@ FIntPoint AGridMazeManager::GetPathStepAt(int32 Index) const
     return FIntPoint(-1, -1);
 }
 
-// ============   ============
+// ============ 리플레이 ============
+
+void AGridMazeManager::StartReplayRecording()
+{
+    ReplayPlayer.Reset();
+    CompleteReset();
+
+    FPuzzleReplayHeader Header;
+    Header.Source = EPuzzleReplaySource::GridMaze;
+    Header.StageHash = FPuzzleReplay::HashStage(FIntPoint(GridRows, GridColumns), CorrectPath);
+    Header.GridSize = FIntPoint(GridRows, GridColumns);
+    Header.StageName = GetName();
+
+    ReplayRecorder.Begin(Header, GetClockTime());
+}
+
+void AGridMazeManager::StopReplayRecording()
+{
+    ReplayRecorder.Stop();
+}
+
+bool AGridMazeManager::SaveReplay(const FString& FilePath) const
+{
+    return ReplayRecorder.SaveToFile(FilePath);
+}
+
+bool AGridMazeManager::PlayReplay(const FString& FilePath, float Speed)
+{
+    FPuzzleReplay Replay;
+    FString Error;
+
+    if (!FPuzzleReplay::LoadFromFile(FilePath, Replay, Error))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("GridMaze replay: %s"), *Error);
+        return false;
+    }
+
+    ReplayRecorder.Stop();
+
+    // 기록된 경로 그대로 재생해야 하므로 리셋에서 새 경로를 만들지 않음
+    {
+        TGuardValue<bool> KeepPath(bRegeneratePathOnReset, false);
+        CompleteReset();
+    }
+
+    ReplayPlayer = MakeShared<FPuzzleReplayPlayer>(MoveTemp(Replay));
+    if (!ReplayPlayer->Play(this, Speed, Error))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("GridMaze replay: %s"), *Error);
+        ReplayPlayer.Reset();
+        return false;
+    }
+
+    return true;
+}
+
+double AGridMazeManager::GetClockTime() const
+{
+    const UWorld* World = GetWorld();
+    double Now = World ? World->GetTimeSeconds() : 0.0;
+
+    // 재생 중에는 다음 기록 입력보다 앞서 가지 않아야 타이머와 입력 순서가 기록과 같음
+    if (IsReplaying())
+    {
+        Now = FMath::Min(Now, ReplayPlayer->GetNextMazeEventTime());
+    }
+
+    return Now;
+}
+
+void AGridMazeManager::ApplyReplayStep(FIntPoint Cell)
+{
+    TGuardValue<bool> ApplyingReplay(bApplyingReplayStep, true);
+    OnCellStep(Cell, nullptr);
+}
+
+// ============ 에디터 도구 ============
 
 void AGridMazeManager::EditorCreateGrid()
 {
@@ -816,46 +993,204 @@ void AGridMazeManager::EditorCreateGrid()
 
 void AGridMazeManager::EditorClearGrid()
 {
-    ClearGridTiles();
+    DestroyAllTiles();
 }
 
-// ============  Լ ============
+// ============ 내부 함수들 ============
 
-void AGridMazeManager::UpdateTimer(float DeltaTime)
+void AGridMazeManager::SyncSimulationSettings()
 {
-    if (TimeRemaining > 0.0f)
-    {
-        TimeRemaining -= DeltaTime;
+    Simulation.Settings.TimeLimit = PuzzleTimeLimit;
+    Simulation.Settings.bContinueTimeOnFail = bContinueTimeOnFail;
+    Simulation.SetLayout(GridRows, GridColumns, CorrectPath);
+}
 
-        OnTimerUpdate.Broadcast(TimeRemaining);
+void AGridMazeManager::SetPreviewActive(bool bActive)
+{
+    bIsShowingPreview = bActive;
+    Simulation.SetShowingPreview(bActive);
+    UpdateTickEnabled();
+}
 
-        if (TimeRemaining <= 10.0f && TimeRemaining > 9.0f)
-        {
-            OnTimeWarning(TimeRemaining);
-        }
+void AGridMazeManager::ProcessSimulationEvents(AGridTile* SteppedTile)
+{
+    TArray<FMazeSimEventData> Events;
 
-        if (TimeRemaining <= 0.0f)
+    // 이벤트 처리 중 리셋 등으로 새 이벤트가 쌓일 수 있음
+    while (Simulation.HasEvents())
+    {
+        Simulation.ConsumeEvents(Events);
+
+        for (const FMazeSimEventData& Event : Events)
         {
-            TimeRemaining = 0.0f;
-            OnTimerUpdate.Broadcast(0.0f);
+            CurrentPathIndex = Event.PathIndex;
 
-            if (ConnectedDisplay)
+            switch (Event.Type)
             {
-                ConnectedDisplay->ShowMessage(TEXT("TIME OUT!"), FLinearColor::Red);
-            }
+            case EMazeSimEvent::StateChanged:
+                CurrentState = Event.State;
+                OnPuzzleStateChanged.Broadcast(Event.State);
+                break;
+
+            case EMazeSimEvent::CorrectStep:
+                SetTileStateAt(Event.Cell.X, Event.Cell.Y, ETileState::Correct);
+                PlaySound(CorrectStepSound);
+                OnCorrectStep(SteppedTile);
+
+                if (ConnectedDisplay)
+                {
+                    ConnectedDisplay->UpdateProgress(Event.PathIndex, CorrectPath.Num());
+                }
+
+                OnProgressUpdate.Broadcast(Event.PathIndex);
+                break;
+
+            case EMazeSimEvent::NextStep:
+                SetTileStateAt(Event.Cell.X, Event.Cell.Y, ETileState::FirstStep);
+                break;
+
+            case EMazeSimEvent::WrongStep:
+                SetTileStateAt(Event.Cell.X, Event.Cell.Y, ETileState::Wrong);
+                PlaySound(WrongStepSound);
+
+                if (ConnectedDisplay)
+                {
+                    ConnectedDisplay->ShowMessage(TEXT("WRONG!"), FLinearColor::Red);
+                }
+
+                OnWrongStep(SteppedTile);
+                break;
+
+            case EMazeSimEvent::WrongReset:
+                SetTileStateAt(Event.Cell.X, Event.Cell.Y, ETileState::Ready);
+                SetAllTilesReady();
+
+                if (CorrectPath.Num() > 0)
+                {
+                    FIntPoint FirstStep = CorrectPath[0];
+                    SetTileStateAt(FirstStep.X, FirstStep.Y, ETileState::FirstStep);
+                }
+
+                if (ConnectedDisplay)
+                {
+                    ConnectedDisplay->ShowMessage(TEXT("TRY AGAIN"), ReadyColor);
+                }
+                break;
+
+            case EMazeSimEvent::TimerChanged:
+                TimeRemaining = Event.Time;
+                OnTimerUpdate.Broadcast(Event.Time);
+                break;
+
+            case EMazeSimEvent::TimeWarning:
+                OnTimeWarning(Event.Time);
+                break;
+
+            case EMazeSimEvent::Completed:
+                PlaySound(SuccessSound);
 
-            FailPuzzle();
+                if (ConnectedDisplay)
+                {
+                    ConnectedDisplay->ShowMessage(TEXT("SUCCESS!"), ConnectedDisplay->SuccessColor);
+                }
+
+                OnPuzzleCompleted_Event.Broadcast();
+                OnPuzzleCompleted();
+                break;
+
+            case EMazeSimEvent::Failed:
+                PlaySound(FailSound);
+
+                if (ConnectedDisplay)
+                {
+                    ConnectedDisplay->ShowMessage(TEXT("TIME OUT!"), ConnectedDisplay->FailedColor);
+                }
+
+                OnPuzzleFailed_Event.Broadcast();
+                OnPuzzleFailed();
+                break;
+
+            case EMazeSimEvent::FailReset:
+            {
+                CompleteReset();
+
+                APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+                if (PlayerPawn)
+                {
+                    RespawnPlayerToStart(PlayerPawn);
+                }
+
+                if (ConnectedDisplay)
+                {
+                    ConnectedDisplay->ShowMessage(TEXT("READY"), ReadyColor);
+                }
+                break;
+            }
+            }
         }
     }
+
+    CurrentPathIndex = Simulation.GetPathIndex();
+    TimeRemaining = Simulation.GetTimeRemaining();
+
+    ScheduleClockUpdate();
+    UpdateTickEnabled();
+}
+
+void AGridMazeManager::AdvanceSimulationClock()
+{
+    if (GetWorld())
+    {
+        Simulation.AdvanceTo(GetClockTime());
+    }
+}
+
+void AGridMazeManager::CatchUpToClock()
+{
+    AdvanceSimulationClock();
+    ProcessSimulationEvents();
+
+    if (PreviewSequencer.IsActive())
+    {
+        UpdatePreviewSequence();
+    }
 }
 
-void AGridMazeManager::SetPuzzleState(EPuzzleState NewState)
+void AGridMazeManager::ScheduleClockUpdate()
 {
-    if (CurrentState != NewState)
+    UWorld* World = GetWorld();
+    if (!bTimerDrivenClock || !World)
+    {
+        return;
+    }
+
+    const double Delay = Simulation.GetTimeUntilNextUpdate();
+    if (Delay < 0.0)
     {
-        CurrentState = NewState;
-        OnPuzzleStateChanged.Broadcast(NewState);
+        World->GetTimerManager().ClearTimer(ClockTimerHandle);
+        return;
     }
+
+    // 0 이하 간격은 타이머를 지우므로 최소 간격 보장
+    World->GetTimerManager().SetTimer(ClockTimerHandle, this, &AGridMazeManager::OnClockTimer,
+        FMath::Max(float(Delay), 0.001f), false);
+}
+
+void AGridMazeManager::OnClockTimer()
+{
+    AdvanceSimulationClock();
+    ProcessSimulationEvents();
+}
+
+void AGridMazeManager::UpdateTickEnabled()
+{
+    SetActorTickEnabled(!bTimerDrivenClock || NeedsStepDetection() || PreviewSequencer.IsActive());
+}
+
+bool AGridMazeManager::NeedsStepDetection() const
+{
+    return bUseBatchedTiles && !bIsShowingPreview && !Simulation.IsPaused() &&
+        (CurrentState == EPuzzleState::Ready || CurrentState == EPuzzleState::Playing);
 }
 
 void AGridMazeManager::ConnectToDisplay()
@@ -865,22 +1200,22 @@ void AGridMazeManager::ConnectToDisplay()
         return;
     }
 
-    TArray<AActor*> FoundDisplays;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), AMazeDisplay::StaticClass(), FoundDisplays);
+    UActorRegistrySubsystem* Registry = UActorRegistrySubsystem::Get(this);
+    if (!Registry)
+    {
+        return;
+    }
 
-    if (FoundDisplays.Num() > 0)
+    ConnectedDisplay = Registry->FindFirstActor<AMazeDisplay>();
+    if (ConnectedDisplay)
     {
-        ConnectedDisplay = Cast<AMazeDisplay>(FoundDisplays[0]);
-        if (ConnectedDisplay)
-        {
-            ConnectedDisplay->ConnectToManager(this);
-        }
+        ConnectedDisplay->ConnectToManager(this);
     }
 }
 
 void AGridMazeManager::CreateTilesInternal()
 {
-    if (!TileClass || GridRows <= 0 || GridColumns <= 0)
+    if ((!TileClass && !bUseBatchedTiles) || GridRows <= 0 || GridColumns <= 0)
     {
         return;
     }
@@ -899,22 +1234,26 @@ void AGridMazeManager::CreateTilesInternal()
 
     bIsCreatingTiles = true;
 
-    DestroyAllTiles();
+    ClearGridTiles();
+
+    if (bUseBatchedTiles)
+    {
+        CreateBatchedTiles();
+        TrimTilePool(MaxPooledTiles);
+        bIsCreatingTiles = false;
+        return;
+    }
+
     GridTiles.SetNum(GridRows * GridColumns);
 
-    //    : Y ٱ, X 
+    //  루프 순서 변경: Y가 바깥, X가 안쪽
     for (int32 Y = 0; Y < GridColumns; Y++)
     {
         for (int32 X = 0; X < GridRows; X++)
         {
             FVector SpawnLocation = CalculateTilePosition(X, Y);
 
-            FActorSpawnParameters SpawnParams;
-            SpawnParams.Owner = this;
-            SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-            AGridTile* NewTile = World->SpawnActor<AGridTile>(
-                TileClass, SpawnLocation, FRotator::ZeroRotator, SpawnParams);
+            AGridTile* NewTile = AcquireTile(SpawnLocation);
 
             if (NewTile && IsValid(NewTile))
             {
@@ -923,8 +1262,9 @@ void AGridMazeManager::CreateTilesInternal()
                 NewTile->SetOwnerManager(this);
                 NewTile->SetGridPosition(X, Y);
                 NewTile->SetTileThickness(TileThickness);
+                NewTile->SetUsePooledLight(LightPool && LightPool->IsPoolActive());
 
-                int32 Index = Y * GridColumns + X;  //  ùٸ
+                int32 Index = CellToInstanceIndex(X, Y);
                 if (GridTiles.IsValidIndex(Index))
                 {
                     GridTiles[Index] = NewTile;
@@ -935,16 +1275,29 @@ void AGridMazeManager::CreateTilesInternal()
         }
     }
 
+    // 새 그리드가 가져가고 남은 여분만 정리
+    TrimTilePool(MaxPooledTiles);
+
     bIsCreatingTiles = false;
 }
 
 void AGridMazeManager::ClearGridTiles()
 {
-    DestroyAllTiles();
+    // 에디터 월드에서 숨겨 둔 타일은 레벨에 저장되므로 풀링은 게임 월드에서만
+    UWorld* World = GetWorld();
+    if (bPoolTiles && World && World->IsGameWorld())
+    {
+        ReleaseTilesToPool();
+    }
+    else
+    {
+        DestroyAllTiles();
+    }
 }
 
 void AGridMazeManager::UpdateTilePositions()
 {
+    // 배치 모드 인스턴스는 로컬 좌표라 액터를 따라 움직임
     for (int32 i = 0; i < GridTiles.Num(); i++)
     {
         AGridTile* Tile = GridTiles[i];
@@ -960,6 +1313,12 @@ void AGridMazeManager::UpdateTilePositions()
 
 void AGridMazeManager::UpdateTileThickness()
 {
+    if (bUseBatchedTiles)
+    {
+        RefreshBatchedInstanceTransforms();
+        return;
+    }
+
     for (AGridTile* Tile : GridTiles)
     {
         if (Tile && IsValid(Tile))
@@ -970,36 +1329,33 @@ void AGridMazeManager::UpdateTileThickness()
 }
 
 FVector AGridMazeManager::CalculateTilePosition(int32 X, int32 Y)
+{
+    return GetTileWorldLocation(X, Y);
+}
+
+FVector AGridMazeManager::GetTileWorldLocation(int32 X, int32 Y) const
+{
+    return GetActorLocation() + GetActorRotation().RotateVector(CalculateTileLocalPosition(X, Y));
+}
+
+FVector AGridMazeManager::CalculateTileLocalPosition(int32 X, int32 Y) const
 {
     float TotalSize = TileSize + TileSpacing;
     float OffsetX = (GridRows - 1) * TotalSize * 0.5f;
     float OffsetY = (GridColumns - 1) * TotalSize * 0.5f;
 
-    FVector LocalPosition = FVector(
+    return FVector(
         X * TotalSize - OffsetX,
         Y * TotalSize - OffsetY,
         0.0f
     );
-
-    return GetActorLocation() + GetActorRotation().RotateVector(LocalPosition);
 }
 
-bool AGridMazeManager::IsValidPosition(int32 X, int32 Y)
+bool AGridMazeManager::IsValidPosition(int32 X, int32 Y) const
 {
     return X >= 0 && X < GridRows && Y >= 0 && Y < GridColumns;
 }
 
-bool AGridMazeManager::IsCorrectNextStep(int32 X, int32 Y)
-{
-    if (!CorrectPath.IsValidIndex(CurrentPathIndex))
-    {
-        return false;
-    }
-
-    FIntPoint ExpectedStep = CorrectPath[CurrentPathIndex];
-    return (X == ExpectedStep.X && Y == ExpectedStep.Y);
-}
-
 void AGridMazeManager::PlaySound(USoundBase* Sound)
 {
     if (Sound && GetWorld())
@@ -1010,6 +1366,15 @@ void AGridMazeManager::PlaySound(USoundBase* Sound)
 
 void AGridMazeManager::ApplyTileColors()
 {
+    if (bUseBatchedTiles)
+    {
+        for (int32 i = 0; i < BatchedTileStates.Num(); i++)
+        {
+            UpdateBatchedInstance(i);
+        }
+        return;
+    }
+
     for (AGridTile* Tile : GridTiles)
     {
         if (Tile && IsValid(Tile))
@@ -1022,30 +1387,53 @@ void AGridMazeManager::ApplyTileColors()
 
 void AGridMazeManager::DestroyAllTiles()
 {
-    for (int32 i = GridTiles.Num() - 1; i >= 0; i--)
+    ReleaseTilesToPool();
+
+    for (AGridTile* Tile : TilePool)
     {
-        AGridTile* Tile = GridTiles[i];
         if (Tile && IsValid(Tile))
         {
-            if (Tile->OnTileStepped.IsBound())
-            {
-                Tile->OnTileStepped.RemoveAll(this);
-            }
             Tile->Destroy();
         }
     }
+    TilePool.Empty();
+}
+
+void AGridMazeManager::ReleaseTilesToPool()
+{
+    TSet<AGridTile*> KnownTiles;
+    KnownTiles.Append(TilePool);
+
+    for (int32 i = GridTiles.Num() - 1; i >= 0; i--)
+    {
+        AGridTile* Tile = GridTiles[i];
+        if (Tile && IsValid(Tile) && !KnownTiles.Contains(Tile))
+        {
+            KnownTiles.Add(Tile);
+            RetireTile(Tile);
+        }
+    }
     GridTiles.Empty();
 
-    if (GetWorld())
+    BatchedTileStates.Empty();
+    OccupiedCell = FIntPoint(-1, -1);
+    if (TileInstances)
     {
-        TArray<AActor*> AllActors;
-        UGameplayStatics::GetAllActorsOfClass(GetWorld(), AGridTile::StaticClass(), AllActors);
+        TileInstances->ClearInstances();
+    }
 
-        for (AActor* Actor : AllActors)
+    // 레벨에 저장돼 있던 타일처럼 목록에 없는 타일도 풀로 회수
+    if (UActorRegistrySubsystem* Registry = UActorRegistrySubsystem::Get(this))
+    {
+        TArray<AGridTile*> OwnedTiles;
+        Registry->GetActors<AGridTile>(OwnedTiles, NAME_None, this);
+
+        for (AGridTile* Tile : OwnedTiles)
         {
-            if (Actor && Actor->GetOwner() == this)
+            if (IsValid(Tile) && !KnownTiles.Contains(Tile))
             {
-                Actor->Destroy();
+                KnownTiles.Add(Tile);
+                RetireTile(Tile);
             }
         }
     }
@@ -1055,17 +1443,78 @@ void AGridMazeManager::DestroyAllTiles()
 
     for (AActor* AttachedActor : AttachedActors)
     {
-        if (AGridTile* GridTile = Cast<AGridTile>(AttachedActor))
+        AGridTile* GridTile = Cast<AGridTile>(AttachedActor);
+        if (GridTile && IsValid(GridTile) && !KnownTiles.Contains(GridTile))
         {
-            AttachedActor->Destroy();
+            KnownTiles.Add(GridTile);
+            RetireTile(GridTile);
         }
     }
+
+    // 같은 크기로 다시 만들 때 전부 재사용할 수 있게 현재 그리드만큼은 남김
+    TrimTilePool(FMath::Max(MaxPooledTiles, GridRows * GridColumns));
+}
+
+void AGridMazeManager::TrimTilePool(int32 MaxTiles)
+{
+    while (TilePool.Num() > FMath::Max(0, MaxTiles))
+    {
+        AGridTile* Tile = TilePool.Pop(EAllowShrinking::No);
+        if (Tile && IsValid(Tile))
+        {
+            Tile->Destroy();
+        }
+    }
+}
+
+void AGridMazeManager::RetireTile(AGridTile* Tile)
+{
+    if (Tile->OnTileStepped.IsBound())
+    {
+        Tile->OnTileStepped.RemoveAll(this);
+    }
+
+    Tile->SetActorHiddenInGame(true);
+    Tile->SetActorEnableCollision(false);
+
+    TilePool.Add(Tile);
+}
+
+AGridTile* AGridMazeManager::AcquireTile(const FVector& Location)
+{
+    while (TilePool.Num() > 0)
+    {
+        AGridTile* Tile = TilePool.Pop(EAllowShrinking::No);
+        if (!Tile || !IsValid(Tile))
+        {
+            continue;
+        }
+
+        // TileClass가 바뀌었으면 예전 타일은 재사용하지 않음
+        if (Tile->GetClass() != TileClass.Get())
+        {
+            Tile->Destroy();
+            continue;
+        }
+
+        Tile->SetActorLocation(Location);
+        Tile->SetActorHiddenInGame(false);
+        Tile->SetActorEnableCollision(true);
+        return Tile;
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.Owner = this;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    return GetWorld()->SpawnActor<AGridTile>(TileClass, Location, FRotator::ZeroRotator, SpawnParams);
 }
 
 void AGridMazeManager::ResetToStartPosition()
 {
-    CurrentPathIndex = 0;
-    SetPuzzleState(EPuzzleState::Playing);
+    AdvanceSimulationClock();
+    Simulation.RestartPath();
+    ProcessSimulationEvents();
 
     if (bKeepProgressOnFail)
     {
@@ -1075,4 +1524,119 @@ void AGridMazeManager::ResetToStartPosition()
     {
         SetAllTilesReady();
     }
-}
\ No newline at end of file
+}
+
+// ============ 배치 렌더링 ============
+
+void AGridMazeManager::CreateBatchedTiles()
+{
+    if (!TileInstances)
+    {
+        return;
+    }
+
+    TileInstances->SetStaticMesh(BatchedTileMesh);
+    if (BatchedTileMaterial)
+    {
+        TileInstances->SetMaterial(0, BatchedTileMaterial);
+    }
+
+    BatchedTileStates.Init(ETileState::Inactive, GridRows * GridColumns);
+
+    TArray<FTransform> InstanceTransforms;
+    InstanceTransforms.Reserve(BatchedTileStates.Num());
+
+    for (int32 Y = 0; Y < GridColumns; Y++)
+    {
+        for (int32 X = 0; X < GridRows; X++)
+        {
+            InstanceTransforms.Add(CalculateBatchedInstanceTransform(X, Y));
+        }
+    }
+
+    TileInstances->AddInstances(InstanceTransforms, false);
+
+    for (int32 i = 0; i < BatchedTileStates.Num(); i++)
+    {
+        UpdateBatchedInstance(i);
+    }
+}
+
+void AGridMazeManager::RefreshBatchedInstanceTransforms()
+{
+    if (!TileInstances || TileInstances->GetInstanceCount() != BatchedTileStates.Num())
+    {
+        return;
+    }
+
+    for (int32 Y = 0; Y < GridColumns; Y++)
+    {
+        for (int32 X = 0; X < GridRows; X++)
+        {
+            TileInstances->UpdateInstanceTransform(CellToInstanceIndex(X, Y), CalculateBatchedInstanceTransform(X, Y), false, false);
+        }
+    }
+
+    TileInstances->MarkRenderStateDirty();
+}
+
+void AGridMazeManager::UpdateBatchedInstance(int32 Index, bool bMarkRenderStateDirty)
+{
+    if (!TileInstances || !BatchedTileStates.IsValidIndex(Index) || Index >= TileInstances->GetInstanceCount())
+    {
+        return;
+    }
+
+    ETileState State = BatchedTileStates[Index];
+    FLinearColor Color = GetStateColor(State);
+    float Blink = (State == ETileState::FirstStep || State == ETileState::Wrong) ? 1.0f : 0.0f;
+
+    const float CustomData[4] = { Color.R, Color.G, Color.B, Blink };
+    TileInstances->SetCustomData(Index, CustomData, bMarkRenderStateDirty);
+}
+
+FTransform AGridMazeManager::CalculateBatchedInstanceTransform(int32 X, int32 Y) const
+{
+    FVector Scale(TileSize / 100.0f, TileSize / 100.0f, TileThickness / 100.0f);
+    return FTransform(FQuat::Identity, CalculateTileLocalPosition(X, Y), Scale);
+}
+
+FLinearColor AGridMazeManager::GetStateColor(ETileState State) const
+{
+    switch (State)
+    {
+    case ETileState::Preview:
+        return PreviewColor;
+    case ETileState::Ready:
+        return ReadyColor;
+    case ETileState::FirstStep:
+        return FirstStepColor;
+    case ETileState::Correct:
+        return CorrectColor;
+    case ETileState::Wrong:
+        return WrongColor;
+    default:
+        return InactiveColor;
+    }
+}
+
+void AGridMazeManager::UpdateBatchedStepDetection()
+{
+    APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(this, 0);
+
+    FIntPoint Cell;
+    if (!PlayerPawn || !GetCellAtLocation(PlayerPawn->GetActorLocation(), Cell))
+    {
+        OccupiedCell = FIntPoint(-1, -1);
+        return;
+    }
+
+    // 새 칸에 올라섰을 때만 스텝 처리
+    if (Cell == OccupiedCell)
+    {
+        return;
+    }
+
+    OccupiedCell = Cell;
+    OnCellStep(Cell, PlayerPawn);
+}
@@ -1,14 +1,18 @@
 // GridTile.cpp
 #include "Gameplay/GridTile.h"
 #include "Gameplay/GridMazeManager.h"
+#include "Core/ActorRegistrySubsystem.h"
+#include "Core/AnimationSchedulerSubsystem.h"
 #include "Engine/Engine.h"
 #include "Kismet/GameplayStatics.h"
 #include "TimerManager.h"
 #include "Engine/StaticMesh.h"
+#include "Materials/MaterialInstanceDynamic.h"
 
 AGridTile::AGridTile()
 {
-    PrimaryActorTick.bCanEverTick = true;
+    // 깜박임은 UAnimationSchedulerSubsystem에서 처리
+    PrimaryActorTick.bCanEverTick = false;
 
     RootSceneComponent = CreateDefaultSubobject<USceneComponent>(TEXT("RootSceneComponent"));
     RootComponent = RootSceneComponent;
@@ -65,6 +69,18 @@ AGridTile::AGridTile()
     InteractionSphere->SetMobility(EComponentMobility::Movable);
     InteractionSphere->SetSimulatePhysics(false);
 }
+void AGridTile::PostRegisterAllComponents()
+{
+    Super::PostRegisterAllComponents();
+    UActorRegistrySubsystem::AddActor(this);
+}
+
+void AGridTile::PostUnregisterAllComponents()
+{
+    UActorRegistrySubsystem::RemoveActor(this);
+    Super::PostUnregisterAllComponents();
+}
+
 void AGridTile::BeginPlay()
 {
     Super::BeginPlay();
@@ -72,14 +88,14 @@ void AGridTile::BeginPlay()
     SetTileState(ETileState::Inactive);
 }
 
-void AGridTile::Tick(float DeltaTime)
+void AGridTile::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    Super::Tick(DeltaTime);
-
-    if (bIsBlinking)
+    if (UAnimationSchedulerSubsystem* Scheduler = UAnimationSchedulerSubsystem::Get(this))
     {
-        UpdateBlinking(DeltaTime);
+        Scheduler->Stop(BlinkAnimationHandle);
     }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void AGridTile::SetTileState(ETileState NewState)
@@ -125,7 +141,7 @@ void AGridTile::ApplyStateVisuals(ETileState State)
         StateIntensity = FirstStepLightIntensity;
         if (bEnableBlinking && bBlinkOnFirstStep)
         {
-            StartBlinking(0.0f);  //  
+            StartBlinking(0.0f);  // 무한 깜박임
         }
         break;
 
@@ -200,7 +216,11 @@ float AGridTile::GetCurrentLightIntensity() const
 
 void AGridTile::TurnOnLight(FLinearColor Color, float Intensity)
 {
-    if (TileLight)
+    if (bUsePooledLight)
+    {
+        SetEmissiveColor(Color * EmissiveStrength);
+    }
+    else if (TileLight)
     {
         TileLight->SetLightColor(Color);
         TileLight->SetIntensity(Intensity);
@@ -219,6 +239,11 @@ void AGridTile::TurnOffLight()
         TileLight->SetVisibility(false);
     }
 
+    if (bUsePooledLight)
+    {
+        SetEmissiveColor(FLinearColor::Black);
+    }
+
     bIsActivated = false;
     OnLightTurnedOff();
 }
@@ -233,25 +258,67 @@ void AGridTile::SetLightColor(FLinearColor NewColor)
 
 void AGridTile::SetLightIntensity(float NewIntensity)
 {
-    if (TileLight)
+    if (TileLight && !bUsePooledLight)
     {
         TileLight->SetIntensity(NewIntensity);
     }
 }
 
+void AGridTile::SetUsePooledLight(bool bUsePool)
+{
+    if (bUsePooledLight == bUsePool)
+    {
+        return;
+    }
+
+    bUsePooledLight = bUsePool;
+
+    if (TileLight)
+    {
+        TileLight->SetIntensity(0.0f);
+        TileLight->SetVisibility(false);
+    }
+
+    if (bIsActivated)
+    {
+        TurnOnLight(GetCurrentStateColor(), GetCurrentLightIntensity());
+    }
+    else if (!bUsePooledLight)
+    {
+        SetEmissiveColor(FLinearColor::Black);
+    }
+}
+
+void AGridTile::SetEmissiveColor(const FLinearColor& Color)
+{
+    if (!EmissiveMaterial && TileMesh)
+    {
+        EmissiveMaterial = TileMesh->CreateAndSetMaterialInstanceDynamic(0);
+    }
+
+    if (EmissiveMaterial)
+    {
+        EmissiveMaterial->SetVectorParameterValue(EmissiveParameterName, Color);
+    }
+}
+
 void AGridTile::StartBlinking(float Duration)
 {
     if (!bEnableBlinking) return;
 
+    UAnimationSchedulerSubsystem* Scheduler = UAnimationSchedulerSubsystem::Get(this);
+    if (!Scheduler) return;
+
+    Scheduler->Stop(BlinkAnimationHandle);
     bIsBlinking = true;
 
-    if (Duration > 0.0f)
-    {
-        GetWorld()->GetTimerManager().SetTimer(BlinkTimerHandle, [this]()
-            {
-                StopBlinking();
-            }, Duration, false);
-    }
+    BlinkAnimationHandle = Scheduler->StartBlink(this, BlinkSpeed, Duration,
+        [this](float BlinkFactor) { ApplyBlink(BlinkFactor); },
+        [this]()
+        {
+            BlinkAnimationHandle = INDEX_NONE;
+            StopBlinking();
+        });
 }
 
 void AGridTile::StopBlinking()
@@ -259,21 +326,23 @@ void AGridTile::StopBlinking()
     if (bIsBlinking)
     {
         bIsBlinking = false;
-        GetWorld()->GetTimerManager().ClearTimer(BlinkTimerHandle);
 
-        if (TileLight && bIsActivated)
+        if (UAnimationSchedulerSubsystem* Scheduler = UAnimationSchedulerSubsystem::Get(this))
+        {
+            Scheduler->Stop(BlinkAnimationHandle);
+        }
+
+        if (TileLight && bIsActivated && !bUsePooledLight)
         {
             TileLight->SetIntensity(GetCurrentLightIntensity());
         }
     }
 }
 
-void AGridTile::UpdateBlinking(float DeltaTime)
+void AGridTile::ApplyBlink(float BlinkFactor)
 {
-    if (!bIsBlinking || !TileLight) return;
-
-    float Time = GetWorld()->GetTimeSeconds();
-    float BlinkFactor = FMath::Sin(Time * BlinkSpeed * PI) * 0.5f + 0.5f;
+    // 조명 풀 사용 시 깜박임은 풀에서 처리
+    if (!bIsBlinking || !TileLight || bUsePooledLight) return;
 
     float TargetIntensity = GetCurrentLightIntensity();
     float CurrentIntensity = FMath::Lerp(TargetIntensity * 0.3f, TargetIntensity, BlinkFactor);
@@ -347,7 +416,7 @@ void AGridTile::ForceMobilitySettings()
     if (RootSceneComponent) RootSceneComponent->SetMobility(EComponentMobility::Movable);
 }
 
-// InteractableInterface 
+// InteractableInterface 구현
 void AGridTile::Interact_Implementation(AActor* Interactor)
 {
     if (!bCanBeInteracted) return;
@@ -4,6 +4,7 @@
 #include "Components/TextBlock.h"
 #include "Engine/Texture2D.h"
 #include "Save_Instance/Hamoina_GameInstance.h"
+#include "Core/AnimationSchedulerSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 
 
@@ -11,13 +12,13 @@ void UHintWidget::NativeConstruct()
 {
     Super::NativeConstruct();
 
-    // GameInstance   ( )
+    // GameInstance 참조 가져오기 (한 번만)
     if (!GameInstance)
     {
         GameInstance = Cast<UHamoina_GameInstance>(UGameplayStatics::GetGameInstance(this));
     }
 
-    // BlockButtons 迭 ʱȭ ( )
+    // BlockButtons 배열 초기화 (한 번만)
     if (BlockButtons.Num() == 0)
     {
         BlockButtons.Empty();
@@ -29,7 +30,7 @@ void UHintWidget::NativeConstruct()
         BlockButtons.Add(Block5Button);
     }
 
-    // ư ̺Ʈ ε ( )
+    // 버튼 이벤트 바인딩 (한 번만)
     if (!bButtonsBound)
     {
         BindButtonEvents();
@@ -58,28 +59,24 @@ void UHintWidget::NativeConstruct()
 
     UpdateBlockVisibility();
     UpdateCooldownDisplay();
+
+    bIsWidgetConstructed = true;
+    SyncCooldownAnimation();
 }
 
 void UHintWidget::NativeDestruct()
 {
-    //  ı  ư ε 
+    // 화면에서 빠지면 쿨다운 일시정지
+    bIsWidgetConstructed = false;
+    SyncCooldownAnimation();
+
+    // 위젯이 파괴될 때 버튼 바인딩 해제
     UnbindButtonEvents();
     bButtonsBound = false;
 
     Super::NativeDestruct();
 }
 
-void UHintWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
-{
-    Super::NativeTick(MyGeometry, InDeltaTime);
-
-    if (bIsOnCooldown)
-    {
-        UpdateCooldown(InDeltaTime);
-        UpdateCooldownDisplay();
-    }
-}
-
 void UHintWidget::InitializeHint(int32 InLevelNumber)
 {
     CurrentLevelNumber = InLevelNumber;
@@ -92,6 +89,7 @@ void UHintWidget::InitializeHint(int32 InLevelNumber)
     LoadStateFromSaveGame();
     UpdateBlockVisibility();
     UpdateCooldownDisplay();
+    SyncCooldownAnimation();
 }
 
 void UHintWidget::InitializeBlocks()
@@ -183,11 +181,11 @@ void UHintWidget::HandleBlockClick(int32 BlockIndex)
         return;
     }
 
-    //  ر
+    // 블록 해금
     RevealedBlocks[BlockIndex] = true;
     StartCooldown();
 
-    // SaveGame 
+    // SaveGame에 저장
     SaveStateToSaveGame();
 
     UpdateBlockVisibility();
@@ -198,20 +196,48 @@ void UHintWidget::StartCooldown()
 {
     bIsOnCooldown = true;
     CurrentCooldown = RevealCooldown;
+    SyncCooldownAnimation();
 }
 
-void UHintWidget::UpdateCooldown(float DeltaTime)
+void UHintWidget::SyncCooldownAnimation()
 {
-    CurrentCooldown -= DeltaTime;
+    UAnimationSchedulerSubsystem* Scheduler = UAnimationSchedulerSubsystem::Get(this);
+    if (!Scheduler)
+        return;
 
-    if (CurrentCooldown <= 0.0f)
-    {
-        CurrentCooldown = 0.0f;
-        bIsOnCooldown = false;
+    Scheduler->Stop(CooldownAnimationHandle);
 
-        // ٿ  
-        SaveStateToSaveGame();
-    }
+    // 위젯이 화면에 있을 때만 쿨다운 진행
+    if (!bIsOnCooldown || !bIsWidgetConstructed)
+        return;
+
+    CooldownAnimationHandle = Scheduler->StartCountdown(this, CurrentCooldown,
+        [this](float Remaining)
+        {
+            // 표시되는 초가 바뀔 때만 텍스트 갱신
+            bool bSecondChanged = FMath::FloorToInt(Remaining) != FMath::FloorToInt(CurrentCooldown);
+            CurrentCooldown = Remaining;
+
+            if (bSecondChanged)
+            {
+                UpdateCooldownDisplay();
+            }
+        },
+        [this]()
+        {
+            CooldownAnimationHandle = INDEX_NONE;
+            FinishCooldown();
+        });
+}
+
+void UHintWidget::FinishCooldown()
+{
+    CurrentCooldown = 0.0f;
+    bIsOnCooldown = false;
+
+    // 쿨다운 끝났으니 저장
+    SaveStateToSaveGame();
+    UpdateCooldownDisplay();
 }
 
 void UHintWidget::UpdateBlockVisibility()
@@ -251,7 +277,7 @@ void UHintWidget::LoadStateFromSaveGame()
     if (!GameInstance || !GameInstance->CurrentSaveData)
         return;
 
-    // SaveGame ҷ
+    // SaveGame에서 불러오기
     TArray<bool> SavedBlocks = GameInstance->CurrentSaveData->GetHintBlockStates(CurrentLevelNumber);
 
     if (SavedBlocks.Num() == 6)
@@ -277,7 +303,7 @@ void UHintWidget::SaveStateToSaveGame()
     if (!GameInstance || !GameInstance->CurrentSaveData)
         return;
 
-    // SaveGame 
+    // SaveGame에 저장
     GameInstance->CurrentSaveData->SetHintBlockStates(CurrentLevelNumber, RevealedBlocks);
     GameInstance->CurrentSaveData->SetHintCooldownTime(CurrentLevelNumber, CurrentCooldown);
     GameInstance->SaveContinueGame();
@@ -292,8 +318,9 @@ void UHintWidget::ResetHintWidget()
 
     bIsOnCooldown = false;
     CurrentCooldown = 0.0f;
+    SyncCooldownAnimation();
 
-    // SaveGame  
+    // SaveGame에도 리셋 저장
     SaveStateToSaveGame();
 
     UpdateBlockVisibility();
@@ -320,6 +347,7 @@ void UHintWidget::OnLevelReset()
 
     bIsOnCooldown = false;
     CurrentCooldown = 0.0f;
+    SyncCooldownAnimation();
 
     SaveStateToSaveGame();
 
@@ -6,7 +6,7 @@
 UInventoryComponent::UInventoryComponent()
 {
     PrimaryComponentTick.bCanEverTick = false;
-    Capacity = 8; // ⺻ κ丮 뷮
+    Capacity = 8; // 기본 인벤토리 용량
     CurrentSelectedSlot = 0;
     bIsInventoryOpen = false;
 }
@@ -94,10 +94,10 @@ bool UInventoryComponent::HasRoomForItem() const
 
 void UInventoryComponent::AddNoteEntry(const FString& NoteText)
 {
-    // Ʈ   ؽƮ ߰
+    // 노트 아이템의 설명에 텍스트 추가
     if (NoteItem)
     {
-        //  ׸  ٷ 
+        // 새 항목은 새 줄로 구분
         if (!NoteItem->Description.IsEmpty() && !NoteItem->Description.EndsWith("\n"))
         {
             NoteItem->Description.Append("\n");
@@ -110,10 +110,10 @@ void UInventoryComponent::AddNoteEntry(const FString& NoteText)
 void UInventoryComponent::ToggleInventory()
 {
     bIsInventoryOpen = !bIsInventoryOpen;
-    OnInventoryToggled.Broadcast(bIsInventoryOpen); //   ߰
+    OnInventoryToggled.Broadcast(bIsInventoryOpen); // 이 줄 추가
 }
 
-// EXPANDED: MoveSelection Լ 
+// EXPANDED: MoveSelection 함수 수정
 void UInventoryComponent::MoveSelection(int32 Direction)
 {
     if (!bIsInventoryOpen)
@@ -133,7 +133,7 @@ void UInventoryComponent::MoveSelection(int32 Direction)
     }
 
     CurrentSelectedSlot = NewSelection;
-    OnSelectionChanged.Broadcast(CurrentSelectedSlot); // ߰ 
+    OnSelectionChanged.Broadcast(CurrentSelectedSlot); // 추가된 라인
 }
 
 void UInventoryComponent::UseSelectedItem()
@@ -3,7 +3,7 @@
 
 UItem::UItem()
 {
-	// ⺻ 
+	// 기본값 설정
 	Name = TEXT("Item");
 	Description = TEXT("Descript");
 	Icon = nullptr;
@@ -13,6 +13,6 @@ UItem::UItem()
 
 void UItem::Use_Implementation(AActor* User)
 {
-	// ⺻  ƹ ۾  ʽϴ.
-	// ڽ Ŭ   ؾ մϴ.
+	// 기본 구현은 아무 작업도 수행하지 않습니다.
+	// 자식 클래스에서 실제 동작을 구현해야 합니다.
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 // MazeDisplay.cpp
 #include "Gameplay/MazeDisplay.h"
 #include "Gameplay/GridMazeManager.h"
+#include "Core/ActorRegistrySubsystem.h"
+#include "Core/AnimationSchedulerSubsystem.h"
 #include "Components/TextRenderComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/PointLightComponent.h"
@@ -10,7 +12,8 @@
 
 AMazeDisplay::AMazeDisplay()
 {
-    PrimaryActorTick.bCanEverTick = true;
+    // 디스플레이 조명 깜박임은 스케줄러가 갱신하므로 네이티브 틱 불필요
+    PrimaryActorTick.bCanEverTick = false;
 
     RootSceneComponent = CreateDefaultSubobject<USceneComponent>(TEXT("RootSceneComponent"));
     RootComponent = RootSceneComponent;
@@ -50,6 +53,18 @@ AMazeDisplay::AMazeDisplay()
     DisplayLight->SetLightColor(ReadyColor);
 }
 
+void AMazeDisplay::PostRegisterAllComponents()
+{
+    Super::PostRegisterAllComponents();
+    UActorRegistrySubsystem::AddActor(this);
+}
+
+void AMazeDisplay::PostUnregisterAllComponents()
+{
+    UActorRegistrySubsystem::RemoveActor(this);
+    Super::PostUnregisterAllComponents();
+}
+
 void AMazeDisplay::BeginPlay()
 {
     Super::BeginPlay();
@@ -68,24 +83,17 @@ void AMazeDisplay::BeginPlay()
     ShowMessage(ReadyMessage, ReadyColor);
 }
 
-void AMazeDisplay::Tick(float DeltaTime)
+void AMazeDisplay::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    Super::Tick(DeltaTime);
-
-    if (bIsBlinking)
+    if (UAnimationSchedulerSubsystem* Scheduler = UAnimationSchedulerSubsystem::Get(this))
     {
-        BlinkTimer += DeltaTime;
-        float BlinkFactor = FMath::Sin(BlinkTimer * BlinkSpeed * PI) * 0.5f + 0.5f;
-
-        if (DisplayLight)
-        {
-            float CurrentIntensity = FMath::Lerp(200.0f, 1000.0f, BlinkFactor);
-            DisplayLight->SetIntensity(CurrentIntensity);
-        }
+        Scheduler->Stop(BlinkAnimationHandle);
     }
+
+    Super::EndPlay(EndPlayReason);
 }
 
-// ============ ÷  ============
+// ============ 디스플레이 제어 ============
 
 void AMazeDisplay::SetDisplayState(EDisplayState NewState)
 {
@@ -94,7 +102,7 @@ void AMazeDisplay::SetDisplayState(EDisplayState NewState)
         CurrentDisplayState = NewState;
 
         FString Message;
-        FLinearColor Color = FLinearColor::White; // ⺻ ʱȭ ߰
+        FLinearColor Color = FLinearColor::White; // 기본값 초기화 추가
 
         switch (NewState)
         {
@@ -149,7 +157,7 @@ void AMazeDisplay::SetDisplayState(EDisplayState NewState)
             break;
 
         case EDisplayState::Custom:
-            // Custom ¿ ޽/  
+            // Custom 상태에서는 메시지/색상 변경 없음
             break;
         }
 
@@ -171,7 +179,11 @@ void AMazeDisplay::UpdateTime(float TimeRemaining)
     if (bShowTime && TimeText)
     {
         FString TimeString = FormatTime(TimeRemaining);
-        TimeText->SetText(FText::FromString(TimeString));
+        if (!TimeString.Equals(CachedTimeString, ESearchCase::CaseSensitive))
+        {
+            CachedTimeString = TimeString;
+            TimeText->SetText(FText::FromString(TimeString));
+        }
     }
 
     if (ConnectedManager)
@@ -180,8 +192,13 @@ void AMazeDisplay::UpdateTime(float TimeRemaining)
         HandleTimeWarnings(TimeRemaining, TotalTime);
 
         FLinearColor TimeColor = GetTimeColor(TimeRemaining, TotalTime);
-        UpdateTextColors(TimeColor);
-        UpdateLightColor(TimeColor);
+        if (!bHasCachedTimeColor || TimeColor != CachedTimeColor)
+        {
+            CachedTimeColor = TimeColor;
+            bHasCachedTimeColor = !bIsCountingDown;
+            UpdateTextColors(TimeColor);
+            UpdateLightColor(TimeColor);
+        }
     }
 
     CustomUpdateDisplay(TimeRemaining, ConnectedManager ? ConnectedManager->GetCurrentState() : EPuzzleState::Ready);
@@ -209,6 +226,7 @@ void AMazeDisplay::ShowMessage(const FString& Message, FLinearColor Color)
     }
 
     UpdateLightColor(Color);
+    InvalidateTimeCache();
 }
 
 void AMazeDisplay::ShowCustomMessage(const FString& Message)
@@ -239,9 +257,10 @@ void AMazeDisplay::ClearDisplay()
     StopBlinking();
     StopCountdown();
     UpdateLightColor(FLinearColor::Black);
+    InvalidateTimeCache();
 }
 
-// ============ īƮٿ  ============
+// ============ 카운트다운 제어 ============
 
 void AMazeDisplay::StartCountdown()
 {
@@ -274,6 +293,8 @@ void AMazeDisplay::UpdateCountdown()
 {
     if (!bIsCountingDown) return;
 
+    InvalidateTimeCache();
+
     if (CurrentCountdown > 0)
     {
         FString CountdownText = FString::Printf(TEXT("00:0%d"), CurrentCountdown);
@@ -321,15 +342,30 @@ void AMazeDisplay::UpdateCountdown()
     }
 }
 
-// ============ ִϸ̼  ============
+// ============ 애니메이션 제어 ============
 
 void AMazeDisplay::StartBlinking()
 {
-    if (bBlinkOnWarning)
+    if (!bBlinkOnWarning || bIsBlinking)
     {
-        bIsBlinking = true;
-        BlinkTimer = 0.0f;
+        return;
     }
+
+    UAnimationSchedulerSubsystem* Scheduler = UAnimationSchedulerSubsystem::Get(this);
+    if (!Scheduler)
+    {
+        return;
+    }
+
+    bIsBlinking = true;
+    BlinkAnimationHandle = Scheduler->StartBlink(this, BlinkSpeed, 0.0f, [this](float BlinkFactor)
+        {
+            if (DisplayLight)
+            {
+                float CurrentIntensity = FMath::Lerp(200.0f, 1000.0f, BlinkFactor);
+                DisplayLight->SetIntensity(CurrentIntensity);
+            }
+        });
 }
 
 void AMazeDisplay::StopBlinking()
@@ -337,7 +373,11 @@ void AMazeDisplay::StopBlinking()
     if (bIsBlinking)
     {
         bIsBlinking = false;
-        BlinkTimer = 0.0f;
+
+        if (UAnimationSchedulerSubsystem* Scheduler = UAnimationSchedulerSubsystem::Get(this))
+        {
+            Scheduler->Stop(BlinkAnimationHandle);
+        }
 
         if (DisplayLight)
         {
@@ -346,7 +386,7 @@ void AMazeDisplay::StopBlinking()
     }
 }
 
-// ============ Ŵ  ============
+// ============ 매니저 연결 ============
 
 void AMazeDisplay::ConnectToManager(AGridMazeManager* Manager)
 {
@@ -380,20 +420,19 @@ void AMazeDisplay::DisconnectFromManager()
 
 void AMazeDisplay::AutoConnectToManager()
 {
-    TArray<AActor*> FoundManagers;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), AGridMazeManager::StaticClass(), FoundManagers);
+    UActorRegistrySubsystem* Registry = UActorRegistrySubsystem::Get(this);
+    if (!Registry)
+    {
+        return;
+    }
 
-    if (FoundManagers.Num() > 0)
+    if (AGridMazeManager* Manager = Registry->FindFirstActor<AGridMazeManager>())
     {
-        AGridMazeManager* Manager = Cast<AGridMazeManager>(FoundManagers[0]);
-        if (Manager)
-        {
-            ConnectToManager(Manager);
-        }
+        ConnectToManager(Manager);
     }
 }
 
-// ============   Լ ============
+// ============ 설정 변경 함수들 ============
 
 void AMazeDisplay::SetTimeTextSize(float NewSize)
 {
@@ -437,7 +476,7 @@ void AMazeDisplay::SetDisplayMessages(const FString& Ready, const FString& Succe
     FailedMessage = Failed;
 }
 
-// ============  ȸ Լ ============
+// ============ 정보 조회 함수들 ============
 
 FString AMazeDisplay::FormatTime(float TimeInSeconds)
 {
@@ -463,7 +502,7 @@ FString AMazeDisplay::FormatProgress(int32 Current, int32 Max)
     return FString::Printf(TEXT("(%d/%d)"), Current, Max);
 }
 
-// ============ ̺Ʈ ݹ ============
+// ============ 이벤트 콜백들 ============
 
 void AMazeDisplay::OnPuzzleStateChanged(EPuzzleState NewState)
 {
@@ -494,7 +533,7 @@ void AMazeDisplay::OnTimerUpdate(float TimeRemaining)
     }
 }
 
-// ============ BP Ŀ͸  Լ ============
+// ============ BP 커스터마이즈 가능 함수들 ============
 
 FString AMazeDisplay::CustomFormatTime_Implementation(float TimeInSeconds)
 {
@@ -517,7 +556,7 @@ FLinearColor AMazeDisplay::GetTimeColor_Implementation(float TimeRemaining, floa
     }
 }
 
-// ============  Լ ============
+// ============ 내부 함수들 ============
 
 void AMazeDisplay::UpdateVisuals()
 {
@@ -590,4 +629,10 @@ void AMazeDisplay::SetupProgressText()
         ProgressText->SetTextRenderColor(ProgressColor.ToFColor(true));
         ProgressText->SetVisibility(bShowProgress);
     }
-}
\ No newline at end of file
+}
+
+void AMazeDisplay::InvalidateTimeCache()
+{
+    CachedTimeString.Reset();
+    bHasCachedTimeColor = false;
+}
@@ -0,0 +1,416 @@
+// MazePathGenerator.cpp
+#include "Gameplay/MazePathGenerator.h"
+#include "Algo/Reverse.h"
+
+TArray<FIntPoint> FMazePathGenerator::Generate(int32 Rows, int32 Columns, const FMazePathSettings& Settings, FRandomStream& Random)
+{
+    TArray<FIntPoint> Result;
+
+    if (Rows <= 0 || Columns <= 0 || Rows * Columns < 2)
+    {
+        return Result;
+    }
+
+    FMazePathGenerator Generator(Rows, Columns, Settings, Random);
+    TArray<int32> Path;
+
+    if (Settings.Shape == EMazePathShape::Hamiltonian)
+    {
+        Generator.BuildHamiltonian(Path);
+    }
+    else
+    {
+        const int32 TargetLength = FMath::Clamp(FMath::RoundToInt(Generator.NumCells * Settings.Coverage), 2, Generator.NumCells);
+
+        if (!Generator.BuildRandomWalk(TargetLength, Path))
+        {
+            // Dense walks can run out of search budget; any stretch of a Hamiltonian path is a valid walk
+            TArray<int32> Full;
+            Generator.BuildHamiltonian(Full);
+
+            TArray<int32> Starts;
+            for (int32 i = 0; i < Full.Num(); i++)
+            {
+                const bool bForward = i + TargetLength <= Full.Num();
+                const bool bBackward = i - TargetLength + 1 >= 0;
+
+                if (Settings.bStartOnNearEdge && !Generator.IsOnNearEdge(Full[i]))
+                {
+                    continue;
+                }
+
+                // Negative entries walk the path backwards from ~Index
+                if (bForward)
+                {
+                    Starts.Add(i);
+                }
+                if (bBackward)
+                {
+                    Starts.Add(~i);
+                }
+            }
+
+            // BuildHamiltonian puts an end on the near edge, so index 0 is always a candidate
+            const int32 Start = Starts.Num() > 0 ? Starts[Random.RandRange(0, Starts.Num() - 1)] : 0;
+
+            Path.Reset(TargetLength);
+            for (int32 i = 0; i < TargetLength; i++)
+            {
+                Path.Add(Start >= 0 ? Full[Start + i] : Full[~Start - i]);
+            }
+        }
+    }
+
+    Result.Reserve(Path.Num());
+    for (int32 Cell : Path)
+    {
+        Result.Add(FIntPoint(Cell / Columns, Cell % Columns));
+    }
+
+    return Result;
+}
+
+FMazePathGenerator::FMazePathGenerator(int32 InRows, int32 InColumns, const FMazePathSettings& InSettings, FRandomStream& InRandom)
+    : Rows(InRows)
+    , Columns(InColumns)
+    , NumCells(InRows * InColumns)
+    , Settings(InSettings)
+    , Random(InRandom)
+{
+}
+
+bool FMazePathGenerator::BuildRandomWalk(int32 TargetLength, TArray<int32>& OutPath)
+{
+    struct FFrame
+    {
+        int32 Cell;
+        int32 Candidates[4];
+        int32 NumCandidates;
+        int32 Next;
+    };
+
+    TBitArray<> Used(false, NumCells);
+    TArray<FFrame> Stack;
+    Stack.Reserve(TargetLength);
+
+    const float TurnWeight = FMath::Clamp(Settings.TurnFrequency, 0.0f, 1.0f);
+    const float TrailWeight = FMath::Clamp(Settings.BacktrackBias, 0.0f, 1.0f) * 2.0f - 1.0f;
+
+    auto Push = [&](int32 Cell)
+    {
+        FFrame& Frame = Stack.AddDefaulted_GetRef();
+        Frame.Cell = Cell;
+        Frame.NumCandidates = 0;
+        Frame.Next = 0;
+
+        const int32 Previous = Stack.Num() > 1 ? Stack[Stack.Num() - 2].Cell : INDEX_NONE;
+
+        int32 Neighbours[4];
+        float Scores[4];
+        const int32 NumNeighbours = GetNeighbours(Cell, Neighbours);
+
+        for (int32 i = 0; i < NumNeighbours; i++)
+        {
+            const int32 Candidate = Neighbours[i];
+            if (Used[Candidate])
+            {
+                continue;
+            }
+
+            float Score = Random.FRand();
+
+            if (Previous != INDEX_NONE)
+            {
+                Score += (IsTurn(Previous, Cell, Candidate) ? TurnWeight : 1.0f - TurnWeight) * 2.0f;
+            }
+
+            // Cells touching the earlier trail make the walk fold back on itself
+            int32 Around[4];
+            const int32 NumAround = GetNeighbours(Candidate, Around);
+            int32 Touching = 0;
+            for (int32 j = 0; j < NumAround; j++)
+            {
+                Touching += (Around[j] != Cell && Used[Around[j]]) ? 1 : 0;
+            }
+            Score += TrailWeight * Touching;
+
+            // Insertion sort, best score first
+            int32 Slot = Frame.NumCandidates++;
+            while (Slot > 0 && Scores[Slot - 1] < Score)
+            {
+                Scores[Slot] = Scores[Slot - 1];
+                Frame.Candidates[Slot] = Frame.Candidates[Slot - 1];
+                Slot--;
+            }
+            Scores[Slot] = Score;
+            Frame.Candidates[Slot] = Candidate;
+        }
+    };
+
+    const int32 StartCell = Settings.bStartOnNearEdge ? Random.RandRange(0, Columns - 1) : Random.RandRange(0, NumCells - 1);
+    Used[StartCell] = true;
+    Push(StartCell);
+
+    // Walks that need more backtracking than this rarely finish; the Hamiltonian fallback is cheaper
+    int32 Budget = NumCells * 2;
+
+    while (Stack.Num() > 0 && Stack.Num() < TargetLength)
+    {
+        if (--Budget < 0)
+        {
+            return false;
+        }
+
+        FFrame& Top = Stack.Last();
+        if (Top.Next >= Top.NumCandidates)
+        {
+            Used[Top.Cell] = false;
+            Stack.Pop(EAllowShrinking::No);
+            continue;
+        }
+
+        const int32 Next = Top.Candidates[Top.Next++];
+        Used[Next] = true;
+
+        // Skip steps that seal the walk into a pocket too small for the rest of it
+        const int32 Remaining = TargetLength - Stack.Num() - 1;
+        if (Remaining > 0 && MaySplitFreeCells(Next, Used) && CountReachable(Next, Used, Remaining) < Remaining)
+        {
+            Used[Next] = false;
+            continue;
+        }
+
+        Push(Next);
+    }
+
+    if (Stack.Num() < TargetLength)
+    {
+        return false;
+    }
+
+    OutPath.Reset(Stack.Num());
+    for (const FFrame& Frame : Stack)
+    {
+        OutPath.Add(Frame.Cell);
+    }
+
+    return true;
+}
+
+void FMazePathGenerator::BuildHamiltonian(TArray<int32>& OutPath)
+{
+    int32 Turns = 0;
+    BuildSerpentine(OutPath, Turns);
+
+    // Each move reverses part of the path, so a few moves per cell keeps 30x30 within a couple of milliseconds
+    const int32 MixMoves = NumCells * 4;
+    for (int32 Move = 0; Move < MixMoves; Move++)
+    {
+        Backbite(OutPath, Random.RandBool(), Turns, true);
+    }
+
+    // Walks an end over to the near edge; the turn target is ignored so the ends can always move
+    if (Settings.bStartOnNearEdge)
+    {
+        for (int32 Move = 0; Move < NumCells * 8 && !IsOnNearEdge(OutPath[0]) && !IsOnNearEdge(OutPath.Last()); Move++)
+        {
+            Backbite(OutPath, Random.RandBool(), Turns, false);
+        }
+
+        if (!IsOnNearEdge(OutPath[0]) && IsOnNearEdge(OutPath.Last()))
+        {
+            Algo::Reverse(OutPath);
+        }
+        else if (!IsOnNearEdge(OutPath[0]))
+        {
+            // Narrow grids can keep both ends away from the edge; mix from a serpentine with its head pinned instead
+            BuildSerpentine(OutPath, Turns);
+            for (int32 Move = 0; Move < MixMoves; Move++)
+            {
+                Backbite(OutPath, true, Turns, true);
+            }
+        }
+    }
+    else if (Random.RandBool())
+    {
+        Algo::Reverse(OutPath);
+    }
+}
+
+void FMazePathGenerator::BuildSerpentine(TArray<int32>& OutPath, int32& OutTurns)
+{
+    // Mirrored at random so the pinned head can be either corner of row 0
+    const bool bMirror = Random.RandBool();
+
+    OutPath.Reset(NumCells);
+    for (int32 X = 0; X < Rows; X++)
+    {
+        for (int32 i = 0; i < Columns; i++)
+        {
+            const int32 Y = ((X % 2 == 0) != bMirror) ? i : Columns - 1 - i;
+            OutPath.Add(X * Columns + Y);
+        }
+    }
+
+    PathIndex.SetNumUninitialized(NumCells);
+    for (int32 i = 0; i < NumCells; i++)
+    {
+        PathIndex[OutPath[i]] = i;
+    }
+
+    OutTurns = 0;
+    for (int32 i = 1; i < NumCells - 1; i++)
+    {
+        OutTurns += IsTurn(OutPath[i - 1], OutPath[i], OutPath[i + 1]) ? 1 : 0;
+    }
+}
+
+bool FMazePathGenerator::Backbite(TArray<int32>& Path, bool bTail, int32& InOutTurns, bool bFollowTurnTarget)
+{
+    const int32 N = Path.Num();
+    if (N < 3)
+    {
+        return false;
+    }
+
+    // Indices below are taken as if the moving end were the tail
+    auto At = [&Path, N, bTail](int32 Index) { return bTail ? Path[Index] : Path[N - 1 - Index]; };
+
+    const int32 End = At(N - 1);
+
+    int32 Neighbours[4];
+    const int32 NumNeighbours = GetNeighbours(End, Neighbours);
+    const int32 Cell = Neighbours[Random.RandRange(0, NumNeighbours - 1)];
+    const int32 Index = bTail ? PathIndex[Cell] : N - 1 - PathIndex[Cell];
+
+    if (Index == N - 2)
+    {
+        return false;
+    }
+
+    // Linking End to Cell and dropping the link after Cell only changes turns at these cells
+    int32 Before = IsTurn(At(Index), At(Index + 1), At(Index + 2)) ? 1 : 0;
+    int32 After = IsTurn(Cell, End, At(N - 2)) ? 1 : 0;
+    if (Index > 0)
+    {
+        Before += IsTurn(At(Index - 1), Cell, At(Index + 1)) ? 1 : 0;
+        After += IsTurn(At(Index - 1), Cell, End) ? 1 : 0;
+    }
+
+    const float Target = FMath::Clamp(Settings.TurnFrequency, 0.0f, 1.0f);
+    const float Interior = float(N - 2);
+    const float CurrentError = FMath::Abs(InOutTurns / Interior - Target);
+    const float NewError = FMath::Abs((InOutTurns + After - Before) / Interior - Target);
+
+    // Moves away from the target turn rate are mostly rejected; the rest keep the path mixing
+    if (bFollowTurnTarget && NewError > CurrentError && Random.FRand() < 0.8f)
+    {
+        return false;
+    }
+
+    const int32 First = bTail ? Index + 1 : 0;
+    const int32 Last = bTail ? N - 1 : N - 2 - Index;
+
+    for (int32 Low = First, High = Last; Low < High; Low++, High--)
+    {
+        Swap(Path[Low], Path[High]);
+    }
+    for (int32 i = First; i <= Last; i++)
+    {
+        PathIndex[Path[i]] = i;
+    }
+
+    InOutTurns += After - Before;
+    return true;
+}
+
+bool FMazePathGenerator::MaySplitFreeCells(int32 Cell, const TBitArray<>& Used) const
+{
+    static const FIntPoint Ring[8] =
+    {
+        FIntPoint(-1, 0), FIntPoint(-1, 1), FIntPoint(0, 1), FIntPoint(1, 1),
+        FIntPoint(1, 0), FIntPoint(1, -1), FIntPoint(0, -1), FIntPoint(-1, -1)
+    };
+
+    const int32 X = Cell / Columns;
+    const int32 Y = Cell % Columns;
+
+    auto IsFree = [&](int32 i)
+    {
+        const int32 RingX = X + Ring[i].X;
+        const int32 RingY = Y + Ring[i].Y;
+        return RingX >= 0 && RingX < Rows && RingY >= 0 && RingY < Columns && !Used[RingX * Columns + RingY];
+    };
+
+    // Free cells around Cell in one unbroken run stay connected without it
+    int32 Runs = 0;
+    bool bPreviousFree = IsFree(7);
+    for (int32 i = 0; i < 8; i++)
+    {
+        const bool bFree = IsFree(i);
+        Runs += (bFree && !bPreviousFree) ? 1 : 0;
+        bPreviousFree = bFree;
+    }
+
+    return Runs > 1;
+}
+
+int32 FMazePathGenerator::CountReachable(int32 From, const TBitArray<>& Used, int32 Limit)
+{
+    ScratchSeen.Init(false, NumCells);
+    ScratchQueue.Reset();
+    ScratchQueue.Add(From);
+    ScratchSeen[From] = true;
+
+    int32 Count = 0;
+
+    for (int32 Head = 0; Head < ScratchQueue.Num() && Count < Limit; Head++)
+    {
+        int32 Neighbours[4];
+        const int32 NumNeighbours = GetNeighbours(ScratchQueue[Head], Neighbours);
+
+        for (int32 i = 0; i < NumNeighbours; i++)
+        {
+            const int32 Cell = Neighbours[i];
+            if (!Used[Cell] && !ScratchSeen[Cell])
+            {
+                ScratchSeen[Cell] = true;
+                ScratchQueue.Add(Cell);
+                Count++;
+            }
+        }
+    }
+
+    return Count;
+}
+
+int32 FMazePathGenerator::GetNeighbours(int32 Cell, int32 OutNeighbours[4]) const
+{
+    const int32 X = Cell / Columns;
+    const int32 Y = Cell % Columns;
+    int32 Count = 0;
+
+    if (X > 0)
+    {
+        OutNeighbours[Count++] = Cell - Columns;
+    }
+    if (X < Rows - 1)
+    {
+        OutNeighbours[Count++] = Cell + Columns;
+    }
+    if (Y > 0)
+    {
+        OutNeighbours[Count++] = Cell - 1;
+    }
+    if (Y < Columns - 1)
+    {
+        OutNeighbours[Count++] = Cell + 1;
+    }
+
+    return Count;
+}
+
+bool FMazePathGenerator::IsTurn(int32 A, int32 B, int32 C) const
+{
+    return B - A != C - B;
+}
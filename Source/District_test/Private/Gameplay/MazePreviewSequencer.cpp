@@ -0,0 +1,92 @@
+// MazePreviewSequencer.cpp
+#include "Gameplay/MazePreviewSequencer.h"
+
+void FMazePreviewSequencer::Start(const TArray<FIntPoint>& InPath, float InStepInterval, bool bInLoop)
+{
+    Path = InPath;
+    StepInterval = FMath::Max(0.0f, InStepInterval);
+    bLoop = bInLoop;
+    Time = 0.0;
+    bActive = Path.Num() > 0;
+    bEnded = false;
+    DesiredLit = 0;
+    AppliedLit = 0;
+
+    UpdateDesiredLit();
+}
+
+void FMazePreviewSequencer::Stop()
+{
+    bActive = false;
+    bEnded = false;
+    DesiredLit = 0;
+    AppliedLit = 0;
+}
+
+void FMazePreviewSequencer::Advance(float DeltaTime)
+{
+    if (!bActive || bEnded)
+    {
+        return;
+    }
+
+    Time += double(DeltaTime) * Speed;
+
+    const double EndTime = double(Path.Num()) * StepInterval;
+    if (Time < EndTime)
+    {
+        UpdateDesiredLit();
+        return;
+    }
+
+    if (!bLoop || EndTime <= 0.0)
+    {
+        DesiredLit = Path.Num();
+        bEnded = true;
+        return;
+    }
+
+    // Cells still lit from the last pass are turned off from the end as the new pass catches up
+    Time = FMath::Fmod(Time, EndTime);
+    UpdateDesiredLit();
+}
+
+void FMazePreviewSequencer::SkipToEnd()
+{
+    if (bActive)
+    {
+        DesiredLit = Path.Num();
+        bEnded = true;
+    }
+}
+
+int32 FMazePreviewSequencer::ConsumeChanges(TArray<FMazePreviewChange>& OutChanges, int32 MaxChanges)
+{
+    int32 Count = 0;
+
+    while (Count < MaxChanges && AppliedLit != DesiredLit)
+    {
+        FMazePreviewChange& Change = OutChanges.AddDefaulted_GetRef();
+        if (AppliedLit < DesiredLit)
+        {
+            Change.PathIndex = AppliedLit++;
+            Change.bLit = true;
+        }
+        else
+        {
+            Change.PathIndex = --AppliedLit;
+            Change.bLit = false;
+        }
+        Change.Cell = Path[Change.PathIndex];
+        Count++;
+    }
+
+    return Count;
+}
+
+void FMazePreviewSequencer::UpdateDesiredLit()
+{
+    // The first cell lights at time zero
+    const int32 Due = StepInterval > 0.0f ? FMath::FloorToInt(Time / StepInterval) + 1 : Path.Num();
+    DesiredLit = FMath::Clamp(Due, 0, Path.Num());
+}
@@ -0,0 +1,343 @@
+// MazeSimulation.cpp
+#include "Gameplay/MazeSimulation.h"
+
+namespace MazeSimulation
+{
+    // Keeps float noise at a step boundary from showing the value below it early
+    constexpr double TimerEpsilon = 1e-4;
+}
+
+void FMazeSimulation::SetLayout(int32 InRows, int32 InColumns, const TArray<FIntPoint>& InPath)
+{
+    InRows = FMath::Max(0, InRows);
+    InColumns = FMath::Max(0, InColumns);
+
+    if (InRows == Rows && InColumns == Columns && InPath == Path)
+    {
+        return;
+    }
+
+    Rows = InRows;
+    Columns = InColumns;
+    Path = InPath;
+    PathIndex = 0;
+
+    CompletedCells.Init(false, Rows * Columns);
+    FailedCells.Init(false, Rows * Columns);
+    CompletedLog.Reset();
+    FailedLog.Reset();
+}
+
+bool FMazeSimulation::Start()
+{
+    if (State != EPuzzleState::Ready)
+    {
+        return false;
+    }
+
+    TimeRemaining = Settings.TimeLimit;
+    PathIndex = 0;
+    bPaused = false;
+    RestartTimerEvents();
+    SetState(EPuzzleState::Playing);
+    return true;
+}
+
+EMazeStepResult FMazeSimulation::Step(FIntPoint Cell)
+{
+    if (bShowingPreview)
+    {
+        return EMazeStepResult::Ignored;
+    }
+
+    if (State == EPuzzleState::Ready)
+    {
+        return Start() ? EMazeStepResult::Started : EMazeStepResult::Ignored;
+    }
+
+    if (State != EPuzzleState::Playing || bPaused || !Path.IsValidIndex(PathIndex))
+    {
+        return EMazeStepResult::Ignored;
+    }
+
+    if (Cell != Path[PathIndex])
+    {
+        // A new wrong step restarts the pending reset, like re-arming a timer
+        WrongCell = Cell;
+        WrongResetTime = Now + Settings.WrongResetDelay;
+        Emit(EMazeSimEvent::WrongStep).Cell = Cell;
+        return EMazeStepResult::Wrong;
+    }
+
+    MarkCompleted(Cell);
+    PathIndex++;
+
+    FMazeSimEventData& Correct = Emit(EMazeSimEvent::CorrectStep);
+    Correct.Cell = Cell;
+    Correct.PathIndex = PathIndex;
+
+    if (PathIndex < Path.Num())
+    {
+        Emit(EMazeSimEvent::NextStep).Cell = Path[PathIndex];
+        return EMazeStepResult::Correct;
+    }
+
+    Complete();
+    return EMazeStepResult::Completed;
+}
+
+void FMazeSimulation::AdvanceTo(double InNow)
+{
+    Now = FMath::Max(Now, InNow);
+    RefreshClock();
+
+    if (IsClockRunning() && TimeRemaining <= 0.0f && State != EPuzzleState::Failed)
+    {
+        Fail();
+    }
+
+    // The resets run on wall time and ignore pausing
+    if (WrongResetTime >= 0.0 && Now >= WrongResetTime)
+    {
+        WrongResetTime = -1.0;
+        PathIndex = 0;
+        Emit(EMazeSimEvent::WrongReset).Cell = WrongCell;
+    }
+
+    if (FailResetTime >= 0.0 && Now >= FailResetTime)
+    {
+        FailResetTime = -1.0;
+        Emit(EMazeSimEvent::FailReset);
+    }
+}
+
+double FMazeSimulation::GetTimeUntilNextUpdate() const
+{
+    double Next = -1.0;
+    auto Consider = [&Next](double Delay)
+    {
+        Delay = FMath::Max(0.0, Delay);
+        if (Next < 0.0 || Delay < Next)
+        {
+            Next = Delay;
+        }
+    };
+
+    if (IsClockRunning() && TimeRemaining > 0.0f)
+    {
+        Consider(TimeRemaining - QuantizeTime(TimeRemaining) + MazeSimulation::TimerEpsilon * GetTimerStep(TimeRemaining));
+        Consider(TimeRemaining);
+
+        if (!bTimeWarningSent && TimeRemaining > Settings.TimeWarningThreshold)
+        {
+            Consider(TimeRemaining - Settings.TimeWarningThreshold);
+        }
+    }
+
+    if (WrongResetTime >= 0.0)
+    {
+        Consider(WrongResetTime - Now);
+    }
+
+    if (FailResetTime >= 0.0)
+    {
+        Consider(FailResetTime - Now);
+    }
+
+    return Next;
+}
+
+void FMazeSimulation::Complete()
+{
+    SetState(EPuzzleState::Success);
+    Emit(EMazeSimEvent::Completed);
+}
+
+void FMazeSimulation::Fail()
+{
+    SetState(EPuzzleState::Failed);
+    FailResetTime = Now + Settings.FailResetDelay;
+    Emit(EMazeSimEvent::Failed);
+}
+
+void FMazeSimulation::Reset()
+{
+    SetState(EPuzzleState::Ready);
+    TimeRemaining = Settings.TimeLimit;
+    PathIndex = 0;
+    bPaused = false;
+    RestartTimerEvents();
+    WrongResetTime = -1.0;
+    FailResetTime = -1.0;
+}
+
+void FMazeSimulation::SetPaused(bool bInPaused)
+{
+    bPaused = bInPaused;
+    RefreshClock();
+}
+
+void FMazeSimulation::SetTimeRemaining(float InTimeRemaining)
+{
+    RefreshClock();
+
+    TimeRemaining = InTimeRemaining;
+    ClockStartRemaining = InTimeRemaining;
+    if (IsClockRunning())
+    {
+        ClockStartTime = Now;
+    }
+
+    RestartTimerEvents();
+    if (IsClockRunning())
+    {
+        EmitTimerIfChanged();
+    }
+}
+
+void FMazeSimulation::RestartPath()
+{
+    PathIndex = 0;
+    SetState(EPuzzleState::Playing);
+}
+
+bool FMazeSimulation::MarkCompleted(FIntPoint Cell)
+{
+    const int32 Index = ToIndex(Cell);
+    if (Index == INDEX_NONE || CompletedCells[Index])
+    {
+        return false;
+    }
+
+    CompletedCells[Index] = true;
+    CompletedLog.Add(Cell);
+    return true;
+}
+
+bool FMazeSimulation::MarkFailed(FIntPoint Cell)
+{
+    const int32 Index = ToIndex(Cell);
+    if (Index == INDEX_NONE || FailedCells[Index])
+    {
+        return false;
+    }
+
+    FailedCells[Index] = true;
+    FailedLog.Add(Cell);
+    return true;
+}
+
+bool FMazeSimulation::IsCompleted(FIntPoint Cell) const
+{
+    const int32 Index = ToIndex(Cell);
+    return Index != INDEX_NONE && CompletedCells[Index];
+}
+
+bool FMazeSimulation::IsFailed(FIntPoint Cell) const
+{
+    const int32 Index = ToIndex(Cell);
+    return Index != INDEX_NONE && FailedCells[Index];
+}
+
+void FMazeSimulation::ClearProgress()
+{
+    // Only the marked bits are cleared, so this stays proportional to the progress made
+    for (const FIntPoint& Cell : CompletedLog)
+    {
+        CompletedCells[ToIndex(Cell)] = false;
+    }
+    for (const FIntPoint& Cell : FailedLog)
+    {
+        FailedCells[ToIndex(Cell)] = false;
+    }
+
+    CompletedLog.Reset();
+    FailedLog.Reset();
+}
+
+void FMazeSimulation::ConsumeEvents(TArray<FMazeSimEventData>& OutEvents)
+{
+    OutEvents.Reset();
+    Swap(OutEvents, Events);
+}
+
+void FMazeSimulation::SetState(EPuzzleState NewState)
+{
+    if (State != NewState)
+    {
+        State = NewState;
+        Emit(EMazeSimEvent::StateChanged).State = NewState;
+    }
+
+    RefreshClock();
+}
+
+FMazeSimEventData& FMazeSimulation::Emit(EMazeSimEvent Type)
+{
+    FMazeSimEventData& Event = Events.AddDefaulted_GetRef();
+    Event.Type = Type;
+    Event.PathIndex = PathIndex;
+    Event.State = State;
+    return Event;
+}
+
+void FMazeSimulation::RefreshClock()
+{
+    if (IsClockRunning())
+    {
+        TimeRemaining = FMath::Max(0.0f, float(ClockStartRemaining - (Now - ClockStartTime)));
+    }
+
+    const bool bShouldRun = !bPaused &&
+        (State == EPuzzleState::Playing || (State == EPuzzleState::Failed && Settings.bContinueTimeOnFail));
+
+    if (bShouldRun && !IsClockRunning())
+    {
+        ClockStartTime = Now;
+        ClockStartRemaining = TimeRemaining;
+    }
+    else if (!bShouldRun)
+    {
+        ClockStartTime = -1.0;
+    }
+
+    if (IsClockRunning())
+    {
+        EmitTimerIfChanged();
+    }
+}
+
+void FMazeSimulation::EmitTimerIfChanged()
+{
+    const double Displayed = QuantizeTime(TimeRemaining);
+    if (Displayed != LastTimerValue)
+    {
+        LastTimerValue = Displayed;
+        Emit(EMazeSimEvent::TimerChanged).Time = TimeRemaining;
+    }
+
+    if (!bTimeWarningSent && TimeRemaining <= Settings.TimeWarningThreshold)
+    {
+        bTimeWarningSent = true;
+        Emit(EMazeSimEvent::TimeWarning).Time = TimeRemaining;
+    }
+}
+
+void FMazeSimulation::RestartTimerEvents()
+{
+    LastTimerValue = -1.0;
+
+    // A clock that starts below the threshold never crossed it
+    bTimeWarningSent = TimeRemaining <= Settings.TimeWarningThreshold;
+}
+
+float FMazeSimulation::GetTimerStep(float Time) const
+{
+    return FMath::Max(Time <= Settings.TimeWarningThreshold ? Settings.WarningTimerStep : Settings.TimerStep, 0.01f);
+}
+
+double FMazeSimulation::QuantizeTime(float Time) const
+{
+    const double Step = GetTimerStep(Time);
+    return FMath::FloorToDouble(Time / Step + MazeSimulation::TimerEpsilon) * Step;
+}
@@ -1,6 +1,7 @@
 #include "Gameplay/Pedestal.h"
 #include "Kismet/GameplayStatics.h"
 #include "Gameplay/PickupActor.h"
+#include "Core/ActorRegistrySubsystem.h"
 #include "Character/HamoniaCharacter.h"
 
 APedestal::APedestal()
@@ -233,34 +234,34 @@ void APedestal::PostEditMove(bool bFinished)
 
 void APedestal::FindOwnerPuzzleArea()
 {
-    TArray<AActor*> FoundAreas;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), APuzzleArea::StaticClass(), FoundAreas);
-
     if (!bAutoSnapToGrid)
         return;
 
-    for (AActor* Area : FoundAreas)
+    UActorRegistrySubsystem* Registry = UActorRegistrySubsystem::Get(this);
+    if (!Registry)
+        return;
+
+    TArray<APuzzleArea*> FoundAreas;
+    Registry->GetActors<APuzzleArea>(FoundAreas);
+
+    for (APuzzleArea* PuzzleArea : FoundAreas)
     {
-        APuzzleArea* PuzzleArea = Cast<APuzzleArea>(Area);
-        if (PuzzleArea)
+        int32 Row, Column;
+        if (PuzzleArea->GetGridIndexFromWorldLocation(GetActorLocation(), Row, Column))
         {
-            int32 Row, Column;
-            if (PuzzleArea->GetGridIndexFromWorldLocation(GetActorLocation(), Row, Column))
-            {
-                OwnerPuzzleArea = PuzzleArea;
-                GridRow = Row;
-                GridColumn = Column;
+            OwnerPuzzleArea = PuzzleArea;
+            GridRow = Row;
+            GridColumn = Column;
 
-                if (GetWorld() && GetWorld()->IsEditorWorld())
-                {
-                    FVector CellCenter = OwnerPuzzleArea->GetWorldLocationFromGridIndex(Row, Column);
-                    CellCenter.Z = GetActorLocation().Z;
-                    SetActorLocation(CellCenter);
-                }
-
-                OwnerPuzzleArea->RegisterPedestal(this, Row, Column);
-                return;
+            if (GetWorld() && GetWorld()->IsEditorWorld())
+            {
+                FVector CellCenter = OwnerPuzzleArea->GetWorldLocationFromGridIndex(Row, Column);
+                CellCenter.Z = GetActorLocation().Z;
+                SetActorLocation(CellCenter);
             }
+
+            OwnerPuzzleArea->RegisterPedestal(this, Row, Column);
+            return;
         }
     }
 }
@@ -327,10 +328,10 @@ bool APedestal::Push(FVector Direction)
 
     ClearPreviousCell();
 
-    // : Z  
-    float CurrentZ = GetActorLocation().Z;  //  Z  
+    // 수정: Z 높이 유지
+    float CurrentZ = GetActorLocation().Z;  // 현재 Z 높이 저장
     FVector NewLocation = OwnerPuzzleArea->GetWorldLocationFromGridIndex(TargetRow, TargetColumn);
-    NewLocation.Z = CurrentZ;  //  Z ̷ 
+    NewLocation.Z = CurrentZ;  // 원래 Z 높이로 복원
 
     SetActorLocation(NewLocation);
 
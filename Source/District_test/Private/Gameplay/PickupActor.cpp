@@ -9,7 +9,7 @@
 
 APickupActor::APickupActor()
 {
-    PrimaryActorTick.bCanEverTick = true;
+    PrimaryActorTick.bCanEverTick = false;
 
     MeshComponent = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("MeshComponent"));
     RootComponent = MeshComponent;
@@ -56,21 +56,6 @@ void APickupActor::BeginPlay()
     ApplyMeshRotation();
 }
 
-void APickupActor::Tick(float DeltaTime)
-{
-    Super::Tick(DeltaTime);
-
-    if (InteractionWidgetComponent && MeshComponent && InteractionWidgetComponent->IsVisible())
-    {
-        FVector MeshBoundsOrigin;
-        FVector MeshBoundsExtent;
-        MeshComponent->GetLocalBounds(MeshBoundsOrigin, MeshBoundsExtent);
-
-        FVector WidgetOffset = MeshBoundsOrigin + FVector(0.f, 0.f, MeshBoundsExtent.Z + 50.f);
-        InteractionWidgetComponent->SetRelativeLocation(WidgetOffset);
-    }
-}
-
 void APickupActor::OnConstruction(const FTransform& Transform)
 {
     Super::OnConstruction(Transform);
@@ -85,7 +70,7 @@ void APickupActor::OnConstruction(const FTransform& Transform)
         FVector WidgetOffset = FVector(0.f, 0.f, MeshBoundsExtent.Z + 50.f);
         InteractionWidgetComponent->SetRelativeLocation(WidgetOffset);
 
-        InteractionWidgetComponent->SetVisibility(false);  // ߰
+        InteractionWidgetComponent->SetVisibility(false);  // 추가
     }
 }
 
@@ -241,6 +226,17 @@ void APickupActor::ShowInteractionWidget_Implementation()
 {
     if (InteractionWidgetComponent)
     {
+        // 메시 로컬 바운드는 변하지 않으므로 표시할 때 한 번만 위치 계산
+        if (MeshComponent)
+        {
+            FVector MeshBoundsOrigin;
+            FVector MeshBoundsExtent;
+            MeshComponent->GetLocalBounds(MeshBoundsOrigin, MeshBoundsExtent);
+
+            FVector WidgetOffset = MeshBoundsOrigin + FVector(0.f, 0.f, MeshBoundsExtent.Z + 50.f);
+            InteractionWidgetComponent->SetRelativeLocation(WidgetOffset);
+        }
+
         InteractionWidgetComponent->SetVisibility(true);
     }
 }
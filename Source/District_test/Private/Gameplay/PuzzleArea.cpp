@@ -2,16 +2,17 @@
 #include "DrawDebugHelpers.h"
 #include "Kismet/GameplayStatics.h"
 #include "Gameplay/Pedestal.h"
+#include "Core/ActorRegistrySubsystem.h"
 
 APuzzleArea::APuzzleArea()
 {
     PrimaryActorTick.bCanEverTick = false;
 
-    // GridRoot RootComponent  - ׸ ý ߽
+    // GridRoot를 RootComponent로 설정 - 그리드 시스템의 중심
     GridRoot = CreateDefaultSubobject<USceneComponent>(TEXT("GridRoot"));
     SetRootComponent(GridRoot);
 
-    // AreaBox GridRoot   
+    // AreaBox는 GridRoot에 붙이지만 완전히 독립적
     AreaBox = CreateDefaultSubobject<UBoxComponent>(TEXT("AreaBox"));
     AreaBox->SetupAttachment(GridRoot);
     AreaBox->SetCollisionProfileName(TEXT("BlockAll"));
@@ -80,19 +81,19 @@ void APuzzleArea::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedE
     {
         FName PropertyName = PropertyChangedEvent.Property->GetFName();
 
-        // AreaBox  Ƽ   AreaBox Ʈ
+        // AreaBox 관련 프로퍼티 변경 시 AreaBox만 업데이트
         if (PropertyName == GET_MEMBER_NAME_CHECKED(APuzzleArea, AreaBoxExtent) ||
             PropertyName == GET_MEMBER_NAME_CHECKED(APuzzleArea, AreaBoxOffset))
         {
             UpdateAreaBoxTransform();
         }
-        // Grid  Ƽ   Grid Ʈ
+        // Grid 관련 프로퍼티 변경 시 Grid만 업데이트
         else if (PropertyName == GET_MEMBER_NAME_CHECKED(APuzzleArea, GridRows) ||
             PropertyName == GET_MEMBER_NAME_CHECKED(APuzzleArea, GridColumns) ||
             PropertyName == GET_MEMBER_NAME_CHECKED(APuzzleArea, CellSize) ||
             PropertyName == GET_MEMBER_NAME_CHECKED(APuzzleArea, GridHeight))
         {
-            // Grid ٽ ʱȭ (AreaBox  )
+            // Grid만 다시 초기화 (AreaBox는 영향 없음)
             InitializeGrid();
             UpdateCellVisuals();
         }
@@ -100,6 +101,18 @@ void APuzzleArea::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedE
 }
 #endif
 
+void APuzzleArea::PostRegisterAllComponents()
+{
+    Super::PostRegisterAllComponents();
+    UActorRegistrySubsystem::AddActor(this);
+}
+
+void APuzzleArea::PostUnregisterAllComponents()
+{
+    UActorRegistrySubsystem::RemoveActor(this);
+    Super::PostUnregisterAllComponents();
+}
+
 void APuzzleArea::BeginPlay()
 {
     Super::BeginPlay();
@@ -119,7 +132,7 @@ void APuzzleArea::BeginPlay()
         UpdateCellVisuals();
     }
 
-    // BeginPlay AreaBox ġ Ȯ
+    // BeginPlay에서도 AreaBox 위치 확정
     UpdateAreaBoxTransform();
 }
 
@@ -131,10 +144,10 @@ void APuzzleArea::OnConstruction(const FTransform& Transform)
     if (GridColumns <= 0) GridColumns = 5;
     if (CellSize <= 0.0f) CellSize = 300.0f;
 
-    // AreaBox Ʈ (׸ )
+    // AreaBox 업데이트 (그리드와 독립적)
     UpdateAreaBoxTransform();
 
-    // Grid ʱȭ
+    // Grid 초기화
     InitializeGrid();
 
     if (BlockedCells.Num() > 0)
@@ -433,7 +446,7 @@ void APuzzleArea::CreateTileAtCell(int32 Row, int32 Column)
 
     if (Grid[Index].TileMesh)
     {
-        // GridRoot ٿ ׸ ý۰ Բ ̵
+        // GridRoot에 붙여서 그리드 시스템과 함께 움직이도록
         Grid[Index].TileMesh->SetupAttachment(GridRoot);
         Grid[Index].TileMesh->RegisterComponent();
         Grid[Index].TileMesh->SetStaticMesh(DefaultTileMesh);
@@ -57,7 +57,7 @@ APuzzleStarter::APuzzleStarter()
         SlotMesh3->SetStaticMesh(SphereMeshAsset.Object);
     }
 
-    // ⺻  3 
+    // 기본 슬롯 3개 설정
     CoreSlots.SetNum(3);
     CoreSlots[0].RequiredCoreTag = FName("BP_RedCore");
     CoreSlots[1].RequiredCoreTag = FName("BP_BlueCore");
@@ -307,7 +307,7 @@ void APuzzleStarter::PlaySound(USoundBase* Sound)
     }
 }
 
-// InteractableInterface 
+// InteractableInterface 구현
 void APuzzleStarter::Interact_Implementation(AActor* Interactor)
 {
     if (!CanInteract_Implementation(Interactor))
@@ -315,7 +315,7 @@ void APuzzleStarter::Interact_Implementation(AActor* Interactor)
         return;
     }
 
-    // ȣۿ    ǥ Ǵ  
+    // 상호작용 시 현재 상태 표시 또는 수동 시작
     if (bAllCoresInserted && !bPuzzleStarted && !bAutoStartWhenComplete)
     {
         StartConnectedPuzzle();
@@ -0,0 +1,272 @@
+// TileLightPoolComponent.cpp
+#include "Gameplay/TileLightPoolComponent.h"
+#include "Gameplay/GridMazeManager.h"
+#include "Gameplay/GridTile.h"
+#include "Components/PointLightComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "GameFramework/Pawn.h"
+#include "Algo/Sort.h"
+
+UTileLightPoolComponent::UTileLightPoolComponent()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
+}
+
+void UTileLightPoolComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    ApplyPoolState();
+}
+
+void UTileLightPoolComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    ReleasePool();
+    Super::EndPlay(EndPlayReason);
+}
+
+void UTileLightPoolComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    TimeSinceReassign += DeltaTime;
+    if (TimeSinceReassign >= ReassignInterval)
+    {
+        RefreshAssignments();
+    }
+
+    UpdateBlinkingLights();
+}
+
+void UTileLightPoolComponent::RefreshAssignments()
+{
+    TimeSinceReassign = 0.0f;
+
+    AGridMazeManager* Manager = GetManager();
+    if (!Manager || !IsPoolActive())
+    {
+        return;
+    }
+
+    EnsurePool();
+
+    struct FCandidate
+    {
+        int32 Band;
+        float DistanceSq;
+        FIntPoint Cell;
+    };
+
+    APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(this, 0);
+    const FVector PlayerLocation = PlayerPawn ? PlayerPawn->GetActorLocation() : Manager->GetActorLocation();
+
+    TArray<FCandidate> Candidates;
+    Candidates.Reserve(Manager->GridRows * Manager->GridColumns);
+
+    for (int32 Y = 0; Y < Manager->GridColumns; Y++)
+    {
+        for (int32 X = 0; X < Manager->GridRows; X++)
+        {
+            ETileState State = Manager->GetTileStateAt(X, Y);
+            if (State == ETileState::Inactive)
+            {
+                continue;
+            }
+
+            // Highlight states always beat plain Ready tiles, then nearest first
+            const int32 Band = State == ETileState::Ready ? 1 : 0;
+            const float DistanceSq = FVector::DistSquared(PlayerLocation, Manager->GetTileWorldLocation(X, Y));
+
+            Candidates.Add({ Band, DistanceSq, FIntPoint(X, Y) });
+        }
+    }
+
+    const int32 NumLit = FMath::Min(Candidates.Num(), PooledLights.Num());
+    if (NumLit < Candidates.Num())
+    {
+        Algo::Sort(Candidates, [](const FCandidate& A, const FCandidate& B)
+        {
+            return A.Band != B.Band ? A.Band < B.Band : A.DistanceSq < B.DistanceSq;
+        });
+    }
+
+    for (int32 i = 0; i < PooledLights.Num(); i++)
+    {
+        UPointLightComponent* Light = PooledLights[i];
+        FLightAssignment& Assignment = Assignments[i];
+
+        if (!Light)
+        {
+            continue;
+        }
+
+        if (i >= NumLit)
+        {
+            if (Assignment.Cell.X >= 0)
+            {
+                Light->SetVisibility(false);
+                Assignment = FLightAssignment();
+            }
+            continue;
+        }
+
+        const FIntPoint Cell = Candidates[i].Cell;
+        FLinearColor Color;
+
+        if (AGridTile* Tile = Manager->GetTileAt(Cell.X, Cell.Y))
+        {
+            Color = Tile->GetCurrentStateColor();
+            Assignment.BaseIntensity = Tile->GetCurrentLightIntensity();
+            Assignment.bBlink = Tile->bIsBlinking;
+            Assignment.BlinkSpeed = Tile->BlinkSpeed;
+        }
+        else
+        {
+            ETileState State = Manager->GetTileStateAt(Cell.X, Cell.Y);
+            Color = Manager->GetStateColor(State);
+            Assignment.BaseIntensity = BatchedLightIntensity;
+            Assignment.bBlink = State == ETileState::FirstStep || State == ETileState::Wrong;
+            Assignment.BlinkSpeed = 3.0f;
+        }
+
+        Assignment.Cell = Cell;
+
+        Light->SetWorldLocation(Manager->GetTileWorldLocation(Cell.X, Cell.Y) + FVector(0.0f, 0.0f, LightHeight));
+        Light->SetLightColor(Color);
+        Light->SetIntensity(Assignment.BaseIntensity);
+        Light->SetVisibility(true);
+    }
+}
+
+void UTileLightPoolComponent::SetMaxActiveLights(int32 NewMax)
+{
+    MaxActiveLights = FMath::Max(0, NewMax);
+
+    if (HasBegunPlay())
+    {
+        ApplyPoolState();
+    }
+}
+
+void UTileLightPoolComponent::SetLightPoolEnabled(bool bEnabled)
+{
+    bEnableLightPool = bEnabled;
+
+    if (HasBegunPlay())
+    {
+        ApplyPoolState();
+    }
+}
+
+void UTileLightPoolComponent::ApplyPoolState()
+{
+    ReleasePool();
+
+    const bool bActive = IsPoolActive();
+
+    // Tiles only read the pool state when spawned or taken from the tile pool,
+    // so existing tiles have to be switched here
+    if (AGridMazeManager* Manager = GetManager())
+    {
+        for (AGridTile* Tile : Manager->GridTiles)
+        {
+            if (IsValid(Tile))
+            {
+                Tile->SetUsePooledLight(bActive);
+            }
+        }
+    }
+
+    if (bActive)
+    {
+        EnsurePool();
+        RefreshAssignments();
+    }
+
+    SetComponentTickEnabled(bActive);
+}
+
+int32 UTileLightPoolComponent::GetActiveLightCount() const
+{
+    int32 Count = 0;
+    for (const FLightAssignment& Assignment : Assignments)
+    {
+        if (Assignment.Cell.X >= 0)
+        {
+            Count++;
+        }
+    }
+    return Count;
+}
+
+void UTileLightPoolComponent::EnsurePool()
+{
+    AActor* Owner = GetOwner();
+    if (!Owner || PooledLights.Num() == MaxActiveLights)
+    {
+        return;
+    }
+
+    ReleasePool();
+
+    PooledLights.Reserve(MaxActiveLights);
+    Assignments.SetNum(MaxActiveLights);
+
+    for (int32 i = 0; i < MaxActiveLights; i++)
+    {
+        UPointLightComponent* Light = NewObject<UPointLightComponent>(Owner, NAME_None, RF_Transient);
+        Light->SetMobility(EComponentMobility::Movable);
+        Light->SetupAttachment(Owner->GetRootComponent());
+        Light->SetAttenuationRadius(LightRadius);
+        Light->SetSourceRadius(20.0f);
+        Light->SetCastShadows(bPooledLightsCastShadows);
+        Light->SetIntensity(0.0f);
+        Light->SetVisibility(false);
+        Light->RegisterComponent();
+
+        PooledLights.Add(Light);
+    }
+}
+
+void UTileLightPoolComponent::ReleasePool()
+{
+    for (UPointLightComponent* Light : PooledLights)
+    {
+        if (Light)
+        {
+            Light->DestroyComponent();
+        }
+    }
+
+    PooledLights.Empty();
+    Assignments.Empty();
+}
+
+void UTileLightPoolComponent::UpdateBlinkingLights()
+{
+    const UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    const float Time = World->GetTimeSeconds();
+
+    for (int32 i = 0; i < PooledLights.Num(); i++)
+    {
+        const FLightAssignment& Assignment = Assignments[i];
+        if (!Assignment.bBlink || !PooledLights[i])
+        {
+            continue;
+        }
+
+        float BlinkFactor = FMath::Sin(Time * Assignment.BlinkSpeed * PI) * 0.5f + 0.5f;
+        PooledLights[i]->SetIntensity(FMath::Lerp(Assignment.BaseIntensity * 0.3f, Assignment.BaseIntensity, BlinkFactor));
+    }
+}
+
+AGridMazeManager* UTileLightPoolComponent::GetManager() const
+{
+    return Cast<AGridMazeManager>(GetOwner());
+}
@@ -74,14 +74,14 @@ void ADialogueTrigger::TriggerDialogue(AHamoniaCharacter* Character)
 		return;
 	}
 
-	// ĳ ⺻ DataTable 
+	// 캐릭터의 기본 DataTable만 사용
 	UDialogueManagerComponent* DialogueManager = Character->GetDialogueManagerComponent();
 	if (!DialogueManager || !DialogueManager->DialogueDataTable)
 	{
 		return;
 	}
 
-	// BP ó  ֵ ̺Ʈ ߻
+	// BP에서 처리할 수 있도록 이벤트 발생
 	OnDialogueTriggerActivated.Broadcast(DialogueSceneID, DialogueManager->DialogueDataTable);
 
 	if (bOneTimeOnly)
@@ -5,7 +5,7 @@ AInteractableActor::AInteractableActor()
 {
     PrimaryActorTick.bCanEverTick = false;
 
-    // ޽ Ʈ 
+    // 메시 컴포넌트 생성
     MeshComponent = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("MeshComponent"));
     RootComponent = MeshComponent;
 }
@@ -17,7 +17,7 @@ void AInteractableActor::BeginPlay()
 
 void AInteractableActor::Interact_Implementation(AActor* Interactor)
 {
-    // Ʈ ̵  ֵ ⺻   
+    // 블루프린트에서 오버라이드할 수 있도록 기본 구현은 비어 있음
 }
 
 bool AInteractableActor::CanInteract_Implementation(AActor* Interactor)
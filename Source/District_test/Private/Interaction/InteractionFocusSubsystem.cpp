@@ -0,0 +1,123 @@
+// InteractionFocusSubsystem.cpp
+#include "Interaction/InteractionFocusSubsystem.h"
+#include "Interaction/InteractableInterface.h"
+#include "Engine/World.h"
+
+void UInteractionFocusSubsystem::Deinitialize()
+{
+    InterfaceCache.Empty();
+    Super::Deinitialize();
+}
+
+bool UInteractionFocusSubsystem::ShouldRetrace(FInteractionFocusViewState& ViewState, const FVector& ViewLocation, const FVector& ViewForward,
+    float MoveThreshold, float AngleThresholdDegrees, float RefreshInterval)
+{
+    const UWorld* World = GetWorld();
+    const double Now = World ? World->GetTimeSeconds() : 0.0;
+
+    bool bRetrace = ViewState.bForceRefresh || ViewState.LastTraceTime < 0.0;
+
+    if (!bRetrace && RefreshInterval >= 0.0f && Now - ViewState.LastTraceTime >= RefreshInterval)
+    {
+        bRetrace = true;
+    }
+
+    if (!bRetrace && FVector::DistSquared(ViewLocation, ViewState.LastLocation) > FMath::Square(MoveThreshold))
+    {
+        bRetrace = true;
+    }
+
+    if (!bRetrace)
+    {
+        const float CosThreshold = FMath::Cos(FMath::DegreesToRadians(AngleThresholdDegrees));
+        if (FVector::DotProduct(ViewForward, ViewState.LastForward) < CosThreshold)
+        {
+            bRetrace = true;
+        }
+    }
+
+    if (!bRetrace)
+    {
+        RecordSkippedUpdate();
+        return false;
+    }
+
+    ViewState.LastLocation = ViewLocation;
+    ViewState.LastForward = ViewForward;
+    ViewState.LastTraceTime = Now;
+    ViewState.bForceRefresh = false;
+
+    RecordTrace();
+    return true;
+}
+
+bool UInteractionFocusSubsystem::ImplementsInteractable(const AActor* Actor)
+{
+    if (!Actor)
+    {
+        return false;
+    }
+
+    UClass* ActorClass = Actor->GetClass();
+    if (const bool* Cached = InterfaceCache.Find(ActorClass))
+    {
+        return *Cached;
+    }
+
+    const bool bImplements = ActorClass->ImplementsInterface(UInteractableInterface::StaticClass());
+    InterfaceCache.Add(ActorClass, bImplements);
+    return bImplements;
+}
+
+void UInteractionFocusSubsystem::RecordTrace()
+{
+    Stats.TotalTraces++;
+    WindowTraces++;
+    UpdateRates();
+}
+
+void UInteractionFocusSubsystem::RecordSkippedUpdate()
+{
+    Stats.TotalSkippedUpdates++;
+    UpdateRates();
+}
+
+void UInteractionFocusSubsystem::RecordFocusChange()
+{
+    Stats.TotalFocusChanges++;
+    WindowFocusChanges++;
+    UpdateRates();
+}
+
+void UInteractionFocusSubsystem::ResetFocusStats()
+{
+    Stats = FInteractionFocusStats();
+    WindowTraces = 0;
+    WindowFocusChanges = 0;
+
+    const UWorld* World = GetWorld();
+    WindowStartTime = World ? World->GetTimeSeconds() : 0.0;
+}
+
+void UInteractionFocusSubsystem::UpdateRates()
+{
+    const UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    const double Now = World->GetTimeSeconds();
+    const double Elapsed = Now - WindowStartTime;
+    if (Elapsed < 1.0)
+    {
+        return;
+    }
+
+    Stats.TracesPerSecond = static_cast<float>(WindowTraces / Elapsed);
+    Stats.FocusChangesPerSecond = static_cast<float>(WindowFocusChanges / Elapsed);
+
+    WindowStartTime = Now;
+    WindowTraces = 0;
+    WindowFocusChanges = 0;
+}
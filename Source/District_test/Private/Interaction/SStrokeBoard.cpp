@@ -0,0 +1,208 @@
+#include "Interaction/SStrokeBoard.h"
+#include "Interaction/UStrokeGrid.h"
+#include "Engine/Texture2D.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/CoreStyle.h"
+#include "Fonts/SlateFontInfo.h"
+#include "InputCoreTypes.h"
+
+void SStrokeBoard::Construct(const FArguments& InArgs)
+{
+    Grid = InArgs._Grid;
+    OnCellClicked = InArgs._OnCellClicked;
+}
+
+FVector2D SStrokeBoard::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+    const UStrokeGrid* GridPtr = Grid.Get();
+    if (!GridPtr)
+    {
+        return FVector2D::ZeroVector;
+    }
+
+    const FIntPoint Size = GridPtr->GetGridLayout().Size;
+    const float CellSize = GridPtr->CurrentCellSize + GridPtr->CellPadding;
+
+    // Rows run along X and columns along Y, matching the uniform grid layout
+    return FVector2D(Size.Y * CellSize, Size.X * CellSize);
+}
+
+float SStrokeBoard::GetCellSize(const FVector2D& LocalSize) const
+{
+    const UStrokeGrid* GridPtr = Grid.Get();
+    const FIntPoint Size = GridPtr ? GridPtr->GetGridLayout().Size : FIntPoint::ZeroValue;
+
+    if (Size.X <= 0 || Size.Y <= 0)
+    {
+        return 0.0f;
+    }
+
+    return FMath::Min(LocalSize.X / Size.Y, LocalSize.Y / Size.X);
+}
+
+const FSlateBrush* SStrokeBoard::GetTextureBrush(UTexture2D* Texture) const
+{
+    if (!Texture)
+    {
+        return nullptr;
+    }
+
+    FSlateBrush& Brush = TextureBrushes.FindOrAdd(Texture);
+    if (Brush.GetResourceObject() != Texture)
+    {
+        Brush.SetResourceObject(Texture);
+        Brush.ImageSize = FVector2D(Texture->GetSizeX(), Texture->GetSizeY());
+    }
+
+    return &Brush;
+}
+
+FIntPoint SStrokeBoard::GetCellAtLocalPosition(const FGeometry& Geometry, FVector2D LocalPosition) const
+{
+    const UStrokeGrid* GridPtr = Grid.Get();
+    const float CellSize = GetCellSize(Geometry.GetLocalSize());
+
+    if (!GridPtr || CellSize <= 0.0f)
+    {
+        return FIntPoint(-1, -1);
+    }
+
+    const FIntPoint Cell(FMath::FloorToInt(LocalPosition.Y / CellSize), FMath::FloorToInt(LocalPosition.X / CellSize));
+    return GridPtr->GetGridLayout().IsInGrid(Cell) ? Cell : FIntPoint(-1, -1);
+}
+
+FReply SStrokeBoard::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    if (MouseEvent.GetEffectingButton() != EKeys::LeftMouseButton)
+    {
+        return FReply::Unhandled();
+    }
+
+    const FIntPoint Cell = GetCellAtLocalPosition(MyGeometry, MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()));
+    if (Cell.X < 0)
+    {
+        return FReply::Unhandled();
+    }
+
+    OnCellClicked.ExecuteIfBound(Cell);
+    return FReply::Handled();
+}
+
+int32 SStrokeBoard::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+    FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+    const UStrokeGrid* GridPtr = Grid.Get();
+    if (!GridPtr)
+    {
+        return LayerId;
+    }
+
+    const FStrokeGridLayout& Layout = GridPtr->GetGridLayout();
+    const float CellSize = GetCellSize(AllottedGeometry.GetLocalSize());
+    if (Layout.Num() == 0 || CellSize <= 0.0f)
+    {
+        return LayerId;
+    }
+
+    const FSlateBrush* WhiteBrush = FCoreStyle::Get().GetBrush("GenericWhiteBox");
+    const float Inset = FMath::Min(GridPtr->CellPadding * 0.5f, CellSize * 0.25f);
+    const FVector2D InnerSize(CellSize - Inset * 2.0f, CellSize - Inset * 2.0f);
+    const FLinearColor WidgetTint = InWidgetStyle.GetColorAndOpacityTint();
+
+    auto CellOrigin = [CellSize](FIntPoint Position)
+    {
+        return FVector2D(Position.Y * CellSize, Position.X * CellSize);
+    };
+
+    // Cells
+    for (int32 Index = 0; Index < Layout.Num(); Index++)
+    {
+        const FIntPoint Position = Layout.ToPosition(Index);
+        const EStrokeCellType CellType = Layout.GetCellType(Index);
+        const int32 PortalID = Layout.GetPortalID(Index);
+        const bool bVisited = GridPtr->IsCellMarkedVisited(Position);
+
+        const FSlateBrush* Brush = GetTextureBrush(GridPtr->GetCellImage(CellType, PortalID, bVisited));
+        const FLinearColor Tint = Brush ? FLinearColor::White : GridPtr->GetCellColor(CellType, PortalID, bVisited);
+
+        FSlateDrawElement::MakeBox(OutDrawElements, LayerId,
+            AllottedGeometry.ToPaintGeometry(InnerSize, FSlateLayoutTransform(CellOrigin(Position) + FVector2D(Inset, Inset))),
+            Brush ? Brush : WhiteBrush, ESlateDrawEffect::None, Tint * WidgetTint);
+    }
+
+    // Path: one polyline per run of adjacent steps; teleport jumps break the line
+    if (GridPtr->bShowPath && GridPtr->VisitedPositions.Num() > 0)
+    {
+        const FVector2D HalfCell(CellSize * 0.5f, CellSize * 0.5f);
+        const float Thickness = FMath::Max(2.0f, CellSize * 0.12f);
+        const FLinearColor PathColor = GridPtr->CurrentPathLineColor * WidgetTint;
+
+        TArray<FVector2f> Points;
+        auto FlushPoints = [&]()
+        {
+            if (Points.Num() >= 2)
+            {
+                FSlateDrawElement::MakeLines(OutDrawElements, LayerId + 1, AllottedGeometry.ToPaintGeometry(),
+                    Points, ESlateDrawEffect::None, PathColor, true, Thickness);
+            }
+            Points.Reset();
+        };
+
+        const int32 PathLength = GridPtr->VisitedPositions.Num();
+        for (int32 i = 0; i < PathLength; i++)
+        {
+            const FIntPoint From = GridPtr->VisitedPositions[i];
+            const FIntPoint To = i + 1 < PathLength ? GridPtr->VisitedPositions[i + 1] : GridPtr->CurrentPlayerPosition;
+
+            if (FMath::Abs(To.X - From.X) + FMath::Abs(To.Y - From.Y) != 1)
+            {
+                FlushPoints();
+                continue;
+            }
+
+            if (Points.Num() == 0)
+            {
+                Points.Add(FVector2f(CellOrigin(From) + HalfCell));
+            }
+            Points.Add(FVector2f(CellOrigin(To) + HalfCell));
+        }
+        FlushPoints();
+    }
+
+    // Player
+    if (Layout.IsInGrid(GridPtr->CurrentPlayerPosition) && !GridPtr->bEditMode)
+    {
+        const FSlateBrush* PlayerBrush = GetTextureBrush(GridPtr->BoardPlayerImage);
+        const float PlayerSize = CellSize * 0.6f;
+        const FVector2D PlayerOffset((CellSize - PlayerSize) * 0.5f, (CellSize - PlayerSize) * 0.5f);
+
+        FSlateDrawElement::MakeBox(OutDrawElements, LayerId + 2,
+            AllottedGeometry.ToPaintGeometry(FVector2D(PlayerSize, PlayerSize), FSlateLayoutTransform(CellOrigin(GridPtr->CurrentPlayerPosition) + PlayerOffset)),
+            PlayerBrush ? PlayerBrush : WhiteBrush, ESlateDrawEffect::None,
+            (PlayerBrush ? FLinearColor::White : GridPtr->BoardPlayerColor) * WidgetTint);
+    }
+
+    // Grid numbers and portal IDs, same text the cell widgets show
+    if (GridPtr->bShowGridNumbers)
+    {
+        const FSlateFontInfo Font = FCoreStyle::GetDefaultFontStyle("Regular", FMath::Clamp(FMath::RoundToInt(CellSize * 0.18f), 6, 14));
+
+        for (int32 Index = 0; Index < Layout.Num(); Index++)
+        {
+            const FIntPoint Position = Layout.ToPosition(Index);
+            FString Label = FString::Printf(TEXT("%d,%d"), Position.X, Position.Y);
+
+            const int32 PortalID = Layout.GetPortalID(Index);
+            if (PortalID != -1)
+            {
+                Label += FString::Printf(TEXT("\nTP:%d"), PortalID);
+            }
+
+            FSlateDrawElement::MakeText(OutDrawElements, LayerId + 3,
+                AllottedGeometry.ToPaintGeometry(InnerSize, FSlateLayoutTransform(CellOrigin(Position) + FVector2D(Inset + 2.0f, Inset + 2.0f))),
+                Label, Font, ESlateDrawEffect::None, FLinearColor::Black * WidgetTint);
+        }
+    }
+
+    return LayerId + 3;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+#include "Styling/SlateBrush.h"
+#include "UObject/ObjectKey.h"
+
+class UStrokeGrid;
+class UTexture2D;
+
+DECLARE_DELEGATE_OneParam(FOnStrokeBoardCellClicked, FIntPoint /*GridPosition*/);
+
+// Paints a whole stroke board (cells, path, player, debug numbers) in one OnPaint,
+// reading state straight from the owning UStrokeGrid.
+class SStrokeBoard : public SLeafWidget
+{
+public:
+    SLATE_BEGIN_ARGS(SStrokeBoard) {}
+        SLATE_ARGUMENT(TWeakObjectPtr<UStrokeGrid>, Grid)
+        SLATE_EVENT(FOnStrokeBoardCellClicked, OnCellClicked)
+    SLATE_END_ARGS()
+
+    void Construct(const FArguments& InArgs);
+
+    void SetGrid(TWeakObjectPtr<UStrokeGrid> InGrid) { Grid = InGrid; }
+
+    virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+        FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+
+    virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+
+    virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+
+    // Grid position under a local point, or (-1, -1)
+    FIntPoint GetCellAtLocalPosition(const FGeometry& Geometry, FVector2D LocalPosition) const;
+
+private:
+    float GetCellSize(const FVector2D& LocalSize) const;
+    const FSlateBrush* GetTextureBrush(UTexture2D* Texture) const;
+
+    TWeakObjectPtr<UStrokeGrid> Grid;
+    FOnStrokeBoardCellClicked OnCellClicked;
+
+    mutable TMap<TObjectKey<UTexture2D>, FSlateBrush> TextureBrushes;
+};
@@ -0,0 +1,46 @@
+#include "Interaction/StrokeBoardWidget.h"
+#include "Interaction/SStrokeBoard.h"
+#include "Interaction/UStrokeGrid.h"
+
+void UStrokeBoardWidget::SetGrid(UStrokeGrid* InGrid)
+{
+    Grid = InGrid;
+
+    if (MyBoard.IsValid())
+    {
+        MyBoard->SetGrid(Grid);
+        Refresh();
+    }
+}
+
+void UStrokeBoardWidget::Refresh()
+{
+    if (MyBoard.IsValid())
+    {
+        MyBoard->Invalidate(EInvalidateWidgetReason::PaintAndVolatility | EInvalidateWidgetReason::Layout);
+    }
+}
+
+TSharedRef<SWidget> UStrokeBoardWidget::RebuildWidget()
+{
+    MyBoard = SNew(SStrokeBoard)
+        .Grid(Grid)
+        .OnCellClicked(FOnStrokeBoardCellClicked::CreateUObject(this, &UStrokeBoardWidget::HandleCellClicked));
+
+    return MyBoard.ToSharedRef();
+}
+
+void UStrokeBoardWidget::ReleaseSlateResources(bool bReleaseChildren)
+{
+    Super::ReleaseSlateResources(bReleaseChildren);
+
+    MyBoard.Reset();
+}
+
+void UStrokeBoardWidget::HandleCellClicked(FIntPoint GridPosition)
+{
+    if (Grid && Grid->bEditMode)
+    {
+        Grid->OnCellEditClicked(GridPosition);
+    }
+}
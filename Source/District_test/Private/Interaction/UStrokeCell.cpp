@@ -20,7 +20,7 @@ void UStrokeCell::NativeConstruct()
 
     if (CellButton)
     {
-        CellButton->OnClicked.AddDynamic(this, &UStrokeCell::OnCellClicked);
+        CellButton->OnClicked.AddUniqueDynamic(this, &UStrokeCell::OnCellClicked);
         CellButton->SetIsEnabled(false);
     }
 
@@ -34,6 +34,17 @@ void UStrokeCell::SetCellData(const FStrokeCellData& NewCellData)
     UpdateVisuals();
 }
 
+void UStrokeCell::ResetForReuse()
+{
+    bHasPlayer = false;
+
+    if (ConnectedDirections.Num() > 0)
+    {
+        ConnectedDirections.Empty();
+        DrawPathLines();
+    }
+}
+
 void UStrokeCell::UpdateVisuals()
 {
     if (!CellBorder) return;
@@ -71,112 +82,19 @@ UTexture2D* UStrokeCell::GetCustomCellImage() const
         return nullptr;
     }
 
-    if (IsTeleportPortal())
-    {
-        int32 PortalID = GetTeleportPortalID();
-
-        // 湮 Ż Visited ̹ ǥ
-        if (CellData.bIsVisited)
-        {
-            switch (PortalID)
-            {
-            case 1: return ParentGrid->TeleportPortal1VisitedImage;
-            case 2: return ParentGrid->TeleportPortal2VisitedImage;
-            case 3: return ParentGrid->TeleportPortal3VisitedImage;
-            case 4: return ParentGrid->TeleportPortal4VisitedImage;
-            default: return nullptr;
-            }
-        }
-        // 湮  Ż Ϲ ̹
-        else
-        {
-            switch (PortalID)
-            {
-            case 1: return ParentGrid->TeleportPortal1Image;
-            case 2: return ParentGrid->TeleportPortal2Image;
-            case 3: return ParentGrid->TeleportPortal3Image;
-            case 4: return ParentGrid->TeleportPortal4Image;
-            default: return nullptr;
-            }
-        }
-    }
-
-    if (CellData.CellType == EStrokeCellType::Start)
-    {
-        return ParentGrid->StartPointImage;
-    }
-
-    if (CellData.CellType == EStrokeCellType::Goal)
-    {
-        return ParentGrid->GoalPointImage;
-    }
-
-    if (CellData.CellType == EStrokeCellType::Wall)
-    {
-        return ParentGrid->WallImage;
-    }
-
-    if (CellData.CellType == EStrokeCellType::RedPoint)
-    {
-        return CellData.bIsVisited ? ParentGrid->RedPointVisitedImage : ParentGrid->RedPointImage;
-    }
-
-    if (CellData.CellType == EStrokeCellType::GreenPoint)
-    {
-        return CellData.bIsVisited ? ParentGrid->GreenPointVisitedImage : ParentGrid->GreenPointImage;
-    }
-
-    if (CellData.CellType == EStrokeCellType::BluePoint)
-    {
-        return CellData.bIsVisited ? ParentGrid->BluePointVisitedImage : ParentGrid->BluePointImage;
-    }
-
-    if (CellData.CellType == EStrokeCellType::Empty)
-    {
-        if (CellData.bIsVisited)
-        {
-            FLinearColor PathColor = ParentGrid->CurrentPathLineColor;
-
-            if (PathColor == ParentGrid->RedPointColor)
-            {
-                return ParentGrid->VisitedGroundRedImage;
-            }
-            else if (PathColor == ParentGrid->GreenPointColor)
-            {
-                return ParentGrid->VisitedGroundGreenImage;
-            }
-            else if (PathColor == ParentGrid->BluePointColor)
-            {
-                return ParentGrid->VisitedGroundBlueImage;
-            }
-            else
-            {
-                return ParentGrid->VisitedGroundImage;
-            }
-        }
-        else
-        {
-            return ParentGrid->GroundImage;
-        }
-    }
-
-    return nullptr;
+    return ParentGrid->GetCellImage(CellData.CellType, GetTeleportPortalID(), CellData.bIsVisited);
 }
 
 FLinearColor UStrokeCell::GetCellColor() const
 {
-    if (CellData.bIsVisited && CellData.CellType != EStrokeCellType::Start)
+    if (ParentGrid)
     {
-        if (ParentGrid)
-        {
-            return ParentGrid->CurrentPathLineColor;
-        }
-        return FLinearColor(0.5f, 0.5f, 0.5f, 1.0f);
+        return ParentGrid->GetCellColor(CellData.CellType, GetTeleportPortalID(), CellData.bIsVisited);
     }
 
-    if (IsTeleportPortal())
+    if (CellData.bIsVisited && CellData.CellType != EStrokeCellType::Start)
     {
-        return FLinearColor::White;
+        return FLinearColor(0.5f, 0.5f, 0.5f, 1.0f);
     }
 
     return GetCustomCellColor();
@@ -220,30 +138,14 @@ void UStrokeCell::UpdateDebugDisplay(bool bShowDebug)
 
 bool UStrokeCell::IsTeleportPortal() const
 {
-    if (!ParentGrid) return false;
-
-    for (const FTeleportPortal& Portal : ParentGrid->EditorTeleportPortals)
-    {
-        if (Portal.PortalA == CellData.GridPosition || Portal.PortalB == CellData.GridPosition)
-        {
-            return true;
-        }
-    }
-    return false;
+    return GetTeleportPortalID() != -1;
 }
 
 int32 UStrokeCell::GetTeleportPortalID() const
 {
     if (!ParentGrid) return -1;
 
-    for (const FTeleportPortal& Portal : ParentGrid->EditorTeleportPortals)
-    {
-        if (Portal.PortalA == CellData.GridPosition || Portal.PortalB == CellData.GridPosition)
-        {
-            return Portal.PortalID;
-        }
-    }
-    return -1;
+    return ParentGrid->GetTeleportPortalIDAt(CellData.GridPosition);
 }
 
 void UStrokeCell::UpdateInteractionState(bool bIsEditMode)
@@ -272,13 +174,18 @@ void UStrokeCell::OnCellClicked()
 }
 
 void UStrokeCell::UpdatePathConnections(const TArray<FIntPoint>& VisitedPath, FIntPoint CurrentPos)
+{
+    SetPathConnections(VisitedPath.Find(CellData.GridPosition), VisitedPath, CurrentPos);
+}
+
+void UStrokeCell::SetPathConnections(int32 PathIndex, const TArray<FIntPoint>& VisitedPath, FIntPoint CurrentPos)
 {
     ConnectedDirections.Empty();
     FIntPoint MyPos = CellData.GridPosition;
 
-    int32 MyIndex = VisitedPath.Find(MyPos);
+    int32 MyIndex = PathIndex;
 
-    if (MyIndex != INDEX_NONE)
+    if (VisitedPath.IsValidIndex(MyIndex))
     {
         if (MyIndex > 0)
         {
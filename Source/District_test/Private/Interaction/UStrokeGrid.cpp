@@ -1,12 +1,17 @@
 #include "Interaction/UStrokeGrid.h"
 #include "Interaction/UStrokeCell.h"
 #include "Components/UniformGridPanel.h"
+#include "Components/UniformGridSlot.h"
 #include "Components/TextBlock.h"
 #include "Components/Button.h"
 #include "Kismet/GameplayStatics.h"
 #include "Components/Image.h"
 #include "Blueprint/WidgetBlueprintLibrary.h"
 #include "Engine/Engine.h"
+#include "Core/StrokePuzzleSolver.h"
+#include "Interaction/StrokeBoardWidget.h"
+#include "Blueprint/WidgetTree.h"
+#include "Misc/FileHelper.h"
 
 UStrokeGrid::UStrokeGrid(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -60,7 +65,7 @@ void UStrokeGrid::NativeConstruct()
         StatusText->SetVisibility(ESlateVisibility::Hidden);
     }
 
-    if (StageDataTable && CurrentStageNumber > 0)
+    if ((!StageDataTable.IsNull() || GetStagePack()) && CurrentStageNumber > 0)
     {
         LoadStageFromDataTable(CurrentStageNumber);
     }
@@ -70,6 +75,13 @@ void UStrokeGrid::NativeConstruct()
     }
 }
 
+void UStrokeGrid::NativeDestruct()
+{
+    ResetHintEngine();
+    ReplayPlayer.Reset();
+    Super::NativeDestruct();
+}
+
 FReply UStrokeGrid::NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent)
 {
     if (bEditMode || GameState != EStrokeGameState::Playing)
@@ -104,29 +116,58 @@ FReply UStrokeGrid::NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent
         ResetGame();
         return FReply::Handled();
     }
+    else if (PressedKey == EKeys::H)
+    {
+        RequestHint();
+        return FReply::Handled();
+    }
+    else if (PressedKey == EKeys::Z)
+    {
+        UndoMove();
+        return FReply::Handled();
+    }
+    else if (PressedKey == EKeys::Y)
+    {
+        RedoMove();
+        return FReply::Handled();
+    }
 
     return Super::NativeOnKeyDown(InGeometry, InKeyEvent);
 }
 
 void UStrokeGrid::LoadStageFromDataTable(int32 StageNumber)
 {
-    if (!StageDataTable)
-    {
-        return;
-    }
-
     FString RowName = GenerateRowNameFromStage(StageNumber);
     LoadStageFromRowName(*RowName);
 }
 
 void UStrokeGrid::LoadStageFromRowName(FName RowName)
 {
-    if (!StageDataTable)
+    FString PackRowString = RowName.ToString();
+    FStrokeStagePack* Pack = PackRowString.StartsWith(TEXT("Stage_")) ? GetStagePack() : nullptr;
+    if (Pack)
+    {
+        const int32 StageNumber = FCString::Atoi(*PackRowString.RightChop(6));
+
+        FStrokeStageData PackedStage;
+        if (Pack->LoadStage(StageNumber, PackedStage))
+        {
+            CurrentStageRowName = RowName;
+            CurrentStageNumber = StageNumber;
+            LoadStageDataFromTable(PackedStage);
+
+            Pack->Prefetch(StageNumber + 1);
+            return;
+        }
+    }
+
+    UDataTable* Table = StageDataTable.LoadSynchronous();
+    if (!Table)
     {
         return;
     }
 
-    FStrokeStageData* StageData = StageDataTable->FindRow<FStrokeStageData>(RowName, TEXT(""));
+    FStrokeStageData* StageData = Table->FindRow<FStrokeStageData>(RowName, TEXT(""));
 
     if (StageData)
     {
@@ -176,7 +217,7 @@ void UStrokeGrid::LoadStageDataFromTable(const FStrokeStageData& StageData)
 
 void UStrokeGrid::PreviewStageInEditor()
 {
-    if (StageDataTable)
+    if (!StageDataTable.IsNull())
     {
         LoadStageFromDataTable(CurrentStageNumber);
     }
@@ -184,7 +225,7 @@ void UStrokeGrid::PreviewStageInEditor()
 
 void UStrokeGrid::SaveCurrentToDataTable()
 {
-    if (!StageDataTable)
+    if (!StageDataTable.LoadSynchronous())
     {
         return;
     }
@@ -205,6 +246,42 @@ FString UStrokeGrid::GenerateRowNameFromStage(int32 StageNumber) const
     return FString::Printf(TEXT("Stage_%02d"), StageNumber);
 }
 
+FStrokeStagePack* UStrokeGrid::GetStagePack()
+{
+    if (!bStagePackOpened)
+    {
+        bStagePackOpened = true;
+
+        if (!GIsEditor && !StagePackPath.IsEmpty())
+        {
+            StagePack = FStrokeStagePack::Open(StagePackPath);
+        }
+    }
+
+    return StagePack.Get();
+}
+
+void UStrokeGrid::CookStagePack()
+{
+    TArray<uint8> PackData;
+    FString Error;
+
+    if (!FStrokeStagePack::Cook(StageDataTable.LoadSynchronous(), PackData, Error))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("CookStagePack: %s"), *Error);
+        return;
+    }
+
+    const FString FullPath = FStrokeStagePack::ResolvePath(StagePackPath);
+    if (!FFileHelper::SaveArrayToFile(PackData, *FullPath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("CookStagePack: could not write %s"), *FullPath);
+        return;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("CookStagePack: wrote %d bytes to %s"), PackData.Num(), *FullPath);
+}
+
 void UStrokeGrid::ApplyEditorSettings()
 {
     ValidatePositions();
@@ -353,6 +430,58 @@ void UStrokeGrid::AutoCompleteTeleportPairs()
     ApplyEditorSettings();
 }
 
+void UStrokeGrid::CheckSolvable()
+{
+    ApplyEditorSettings();
+
+    FStrokeSolverSettings Settings;
+    Settings.bEnforceRGBOrder = bEnforceRGBOrder;
+
+    const FStrokeSolveResult Result = FStrokePuzzleSolver::Solve(CurrentPuzzle, Settings);
+
+    if (!Result.Error.IsEmpty())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("CheckSolvable: %s"), *Result.Error);
+    }
+    else if (Result.bSolvable)
+    {
+        UE_LOG(LogTemp, Log, TEXT("CheckSolvable: solvable, %s%lld solutions, %.2f ms"),
+            Result.bCountCapped ? TEXT(">=") : TEXT(""), Result.SolutionCount, Result.SolveTimeSeconds * 1000.0);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("CheckSolvable: %s"), Result.bComplete ? TEXT("no solution") : TEXT("search budget exhausted"));
+    }
+}
+
+void UStrokeGrid::GenerateStageInEditor()
+{
+    FStrokeGeneratorSettings Settings = GeneratorSettings;
+    Settings.StageCount = 1;
+    Settings.bEnforceRGBOrder = bEnforceRGBOrder;
+
+    TArray<FStrokeStageData> Stages = FStrokeStageGenerator::Generate(Settings);
+    if (Stages.Num() > 0)
+    {
+        LoadStageDataFromTable(Stages[0]);
+    }
+}
+
+void UStrokeGrid::GenerateStagesToDataTable()
+{
+    UDataTable* Table = StageDataTable.LoadSynchronous();
+    if (!Table)
+    {
+        return;
+    }
+
+    FStrokeGeneratorSettings Settings = GeneratorSettings;
+    Settings.bEnforceRGBOrder = bEnforceRGBOrder;
+
+    FStrokeStageGenerator::WriteToDataTable(Table, FStrokeStageGenerator::Generate(Settings), CurrentStageNumber);
+    LoadStageFromDataTable(CurrentStageNumber);
+}
+
 void UStrokeGrid::OnCellEditClicked(FIntPoint Position)
 {
     if (!bEditMode) return;
@@ -408,7 +537,11 @@ void UStrokeGrid::OnCellEditClicked(FIntPoint Position)
 void UStrokeGrid::InitializeGrid(const FStrokePuzzleData& PuzzleData)
 {
     CurrentPuzzle = PuzzleData;
-    ClearGrid();
+    GridLayout.Build(CurrentPuzzle);
+    ResetHintEngine();
+    ReplayRecorder.Stop();
+    ReplayPlayer.Reset();
+    ClearProgress();
     CreateCells();
 
     if (!bEditMode)
@@ -424,17 +557,68 @@ void UStrokeGrid::CreateCells()
         return;
     }
 
+    if (bUseBoardRenderer)
+    {
+        CellWidgets.Reset();
+        ParkCells(0);
+
+        if (!BoardWidget)
+        {
+            BoardWidget = WidgetTree->ConstructWidget<UStrokeBoardWidget>(UStrokeBoardWidget::StaticClass());
+            BoardWidget->SetGrid(this);
+        }
+
+        if (BoardWidget->GetParent() != GridPanel)
+        {
+            GridPanel->AddChildToUniformGrid(BoardWidget, 0, 0);
+        }
+
+        RefreshBoard();
+        return;
+    }
+
+    if (BoardWidget)
+    {
+        BoardWidget->RemoveFromParent();
+    }
+
     UClass* ClassToUse = StrokeCellWidgetClass ? StrokeCellWidgetClass.Get() : UStrokeCell::StaticClass();
-    CellWidgets.Empty();
+
+    // Widgets of a previous cell class cannot be rebound
+    for (int32 i = CellWidgetPool.Num() - 1; i >= 0; i--)
+    {
+        UStrokeCell* Cell = CellWidgetPool[i];
+        if (!Cell || Cell->GetClass() != ClassToUse)
+        {
+            if (Cell)
+            {
+                Cell->RemoveFromParent();
+            }
+            CellWidgetPool.RemoveAt(i);
+        }
+    }
+
+    CellWidgets.Reset();
 
     for (int32 X = 0; X < CurrentPuzzle.GridSize.X; X++)
     {
         for (int32 Y = 0; Y < CurrentPuzzle.GridSize.Y; Y++)
         {
-            UStrokeCell* NewCell = CreateWidget<UStrokeCell>(this, ClassToUse);
-            if (!NewCell)
+            UStrokeCell* NewCell = nullptr;
+
+            if (CellWidgets.Num() < CellWidgetPool.Num())
+            {
+                NewCell = CellWidgetPool[CellWidgets.Num()];
+                NewCell->ResetForReuse();
+            }
+            else
             {
-                continue;
+                NewCell = CreateWidget<UStrokeCell>(this, ClassToUse);
+                if (!NewCell)
+                {
+                    continue;
+                }
+                CellWidgetPool.Add(NewCell);
             }
 
             FStrokeCellData CellData;
@@ -442,46 +626,114 @@ void UStrokeGrid::CreateCells()
             CellData.CellType = GetCellTypeAtPosition(FIntPoint(X, Y));
             CellData.bIsVisited = false;
 
-            NewCell->SetCellData(CellData);
             NewCell->ParentGrid = this;
+            NewCell->SetCellData(CellData);
             NewCell->UpdateInteractionState(bEditMode);
 
-            GridPanel->AddChildToUniformGrid(NewCell, X, Y);
+            UUniformGridSlot* GridSlot = NewCell->GetParent() == GridPanel ? Cast<UUniformGridSlot>(NewCell->Slot) : nullptr;
+            if (GridSlot)
+            {
+                GridSlot->SetRow(X);
+                GridSlot->SetColumn(Y);
+            }
+            else
+            {
+                GridPanel->AddChildToUniformGrid(NewCell, X, Y);
+            }
+
             CellWidgets.Add(NewCell);
         }
     }
 
+    ParkCells(CellWidgets.Num());
     UpdateEditorVisuals();
 }
 
 void UStrokeGrid::ClearGrid()
 {
-    if (GridPanel)
-    {
-        GridPanel->ClearChildren();
-    }
-
     CellWidgets.Empty();
+    ParkCells(0);
+    ClearProgress();
+}
+
+void UStrokeGrid::ClearProgress()
+{
     VisitedPositions.Empty();
     VisitedRequiredPoints.Empty();
+    ResetProgressMasks();
+    ClearMoveHistory();
+}
+
+void UStrokeGrid::ClearMoveHistory()
+{
+    UndoStack.Reset();
+    RedoStack.Reset();
+    CheckpointDepth = 0;
+}
+
+void UStrokeGrid::ParkCells(int32 FirstParkedIndex)
+{
+    for (int32 i = FirstParkedIndex; i < CellWidgetPool.Num(); i++)
+    {
+        if (CellWidgetPool[i])
+        {
+            CellWidgetPool[i]->RemoveFromParent();
+        }
+    }
+}
+
+void UStrokeGrid::ResetProgressMasks()
+{
+    PathIndexByCell.Init(INDEX_NONE, GridLayout.Num());
+    VisitedRequiredMask.Init(false, GridLayout.GetNumRequiredSlots());
+    NumVisitedRequired = 0;
+    VisitedCellMask.Init(false, GridLayout.Num());
+}
+
+void UStrokeGrid::MarkCellVisited(FIntPoint Position, bool bVisited)
+{
+    const int32 Index = GridLayout.ToIndex(Position);
+    if (VisitedCellMask.IsValidIndex(Index))
+    {
+        VisitedCellMask[Index] = bVisited;
+    }
+
+    if (UStrokeCell* Cell = GetCellAtPosition(Position))
+    {
+        Cell->SetVisited(bVisited);
+    }
+}
+
+bool UStrokeGrid::IsCellMarkedVisited(FIntPoint Position) const
+{
+    const int32 Index = GridLayout.ToIndex(Position);
+    return VisitedCellMask.IsValidIndex(Index) && VisitedCellMask[Index];
+}
+
+void UStrokeGrid::RefreshBoard()
+{
+    if (BoardWidget && bUseBoardRenderer)
+    {
+        BoardWidget->Refresh();
+    }
 }
 
 
 
 bool UStrokeGrid::IsValidMove(FIntPoint NewPosition) const
 {
-    if (NewPosition.X < 0 || NewPosition.X >= CurrentPuzzle.GridSize.X ||
-        NewPosition.Y < 0 || NewPosition.Y >= CurrentPuzzle.GridSize.Y)
+    const int32 Index = GridLayout.ToIndex(NewPosition);
+    if (Index == INDEX_NONE)
     {
         return false;
     }
 
-    if (CurrentPuzzle.WallPositions.Contains(NewPosition))
+    if (GridLayout.IsWall(Index))
     {
         return false;
     }
 
-    if (VisitedPositions.Contains(NewPosition))
+    if (PathIndexByCell.IsValidIndex(Index) && PathIndexByCell[Index] != INDEX_NONE)
     {
         return false;
     }
@@ -543,18 +795,13 @@ void UStrokeGrid::HideClearMessage()
 
 FIntPoint UStrokeGrid::CheckTeleport(FIntPoint Position)
 {
-    for (const FTeleportPortal& Portal : CurrentPuzzle.TeleportPortals)
-    {
-        if (Portal.PortalA == Position && Portal.PortalB.X != -1)
-        {
-            return Portal.PortalB;
-        }
-        else if (Portal.PortalB == Position && Portal.PortalA.X != -1)
-        {
-            return Portal.PortalA;
-        }
-    }
-    return Position;
+    const int32 Partner = GridLayout.GetPortalPartner(GridLayout.ToIndex(Position));
+    return Partner != INDEX_NONE ? GridLayout.ToPosition(Partner) : Position;
+}
+
+int32 UStrokeGrid::GetTeleportPortalIDAt(FIntPoint Position) const
+{
+    return GridLayout.GetPortalID(GridLayout.ToIndex(Position));
 }
 
 UStrokeCell* UStrokeGrid::GetCellAtPosition(FIntPoint Position) const
@@ -580,54 +827,12 @@ int32 UStrokeGrid::GetCellIndex(FIntPoint Position) const
 
 EStrokeCellType UStrokeGrid::GetCellTypeAtPosition(FIntPoint Position) const
 {
-    if (Position == CurrentPuzzle.StartPosition)
-    {
-        return EStrokeCellType::Start;
-    }
-
-    if (Position == CurrentPuzzle.GoalPosition)
-    {
-        return EStrokeCellType::Goal;
-    }
-
-    if (CurrentPuzzle.RequiredPoints.Contains(Position))
-    {
-        int32 Index = CurrentPuzzle.RequiredPoints.Find(Position);
-        switch (Index % 3)
-        {
-        case 0: return EStrokeCellType::RedPoint;
-        case 1: return EStrokeCellType::GreenPoint;
-        case 2: return EStrokeCellType::BluePoint;
-        }
-    }
-
-    if (CurrentPuzzle.WallPositions.Contains(Position))
-    {
-        return EStrokeCellType::Wall;
-    }
-
-    for (const FTeleportPortal& Portal : CurrentPuzzle.TeleportPortals)
-    {
-        if (Portal.PortalA == Position || Portal.PortalB == Position)
-        {
-            return EStrokeCellType::Empty;
-        }
-    }
-
-    return EStrokeCellType::Empty;
+    return GridLayout.GetCellType(GridLayout.ToIndex(Position));
 }
 
 bool UStrokeGrid::AreAllRequiredPointsVisited() const
 {
-    for (const FIntPoint& RequiredPoint : CurrentPuzzle.RequiredPoints)
-    {
-        if (!VisitedRequiredPoints.Contains(RequiredPoint))
-        {
-            return false;
-        }
-    }
-
-    return true;
+    return NumVisitedRequired == GridLayout.GetNumRequiredSlots();
 }
 
 bool UStrokeGrid::IsRGBOrderCorrect() const
@@ -657,22 +862,68 @@ bool UStrokeGrid::IsRGBOrderCorrect() const
 
 void UStrokeGrid::UpdatePathDisplay()
 {
+    RebuildPathIndex();
+
     if (!bShowPath) return;
 
     for (UStrokeCell* Cell : CellWidgets)
     {
-        if (Cell && Cell->CellData.GridPosition != CurrentPlayerPosition)
+        RefreshCellPath(Cell);
+    }
+}
+
+void UStrokeGrid::UpdatePathDisplayAt(TConstArrayView<FIntPoint> Positions)
+{
+    if (!bShowPath) return;
+
+    TArray<UStrokeCell*, TInlineAllocator<4>> Refreshed;
+
+    for (const FIntPoint& Position : Positions)
+    {
+        UStrokeCell* Cell = GetCellAtPosition(Position);
+        if (Cell && !Refreshed.Contains(Cell))
         {
-            Cell->UpdatePathConnections(VisitedPositions, CurrentPlayerPosition);
+            Refreshed.Add(Cell);
+            RefreshCellPath(Cell);
         }
-        else if (Cell)
+    }
+}
+
+void UStrokeGrid::RefreshCellPath(UStrokeCell* Cell)
+{
+    if (!Cell) return;
+
+    if (Cell->CellData.GridPosition != CurrentPlayerPosition)
+    {
+        Cell->SetPathConnections(FindPathIndex(Cell->CellData.GridPosition), VisitedPositions, CurrentPlayerPosition);
+    }
+    else
+    {
+        Cell->ConnectedDirections.Empty();
+        Cell->DrawPathLines();
+    }
+}
+
+void UStrokeGrid::RebuildPathIndex()
+{
+    PathIndexByCell.Init(INDEX_NONE, GridLayout.Num());
+
+    for (int32 i = 0; i < VisitedPositions.Num(); i++)
+    {
+        const int32 Index = GridLayout.ToIndex(VisitedPositions[i]);
+        if (Index != INDEX_NONE && PathIndexByCell[Index] == INDEX_NONE)
         {
-            Cell->ConnectedDirections.Empty();
-            Cell->DrawPathLines();
+            PathIndexByCell[Index] = i;
         }
     }
 }
 
+int32 UStrokeGrid::FindPathIndex(FIntPoint Position) const
+{
+    const int32 Index = GridLayout.ToIndex(Position);
+    return PathIndexByCell.IsValidIndex(Index) ? PathIndexByCell[Index] : INDEX_NONE;
+}
+
 void UStrokeGrid::UpdatePathColor()
 {
     if (VisitedRequiredPoints.Num() == 0)
@@ -726,6 +977,93 @@ void UStrokeGrid::UpdateEditorVisuals()
             Cell->UpdateDebugDisplay(bShowGridNumbers);
         }
     }
+
+    RefreshBoard();
+}
+
+UTexture2D* UStrokeGrid::GetCellImage(EStrokeCellType CellType, int32 PortalID, bool bVisited) const
+{
+    if (PortalID != -1)
+    {
+        switch (PortalID)
+        {
+        case 1: return bVisited ? TeleportPortal1VisitedImage : TeleportPortal1Image;
+        case 2: return bVisited ? TeleportPortal2VisitedImage : TeleportPortal2Image;
+        case 3: return bVisited ? TeleportPortal3VisitedImage : TeleportPortal3Image;
+        case 4: return bVisited ? TeleportPortal4VisitedImage : TeleportPortal4Image;
+        default: return nullptr;
+        }
+    }
+
+    switch (CellType)
+    {
+    case EStrokeCellType::Start:
+        return StartPointImage;
+    case EStrokeCellType::Goal:
+        return GoalPointImage;
+    case EStrokeCellType::Wall:
+        return WallImage;
+    case EStrokeCellType::RedPoint:
+        return bVisited ? RedPointVisitedImage : RedPointImage;
+    case EStrokeCellType::GreenPoint:
+        return bVisited ? GreenPointVisitedImage : GreenPointImage;
+    case EStrokeCellType::BluePoint:
+        return bVisited ? BluePointVisitedImage : BluePointImage;
+    case EStrokeCellType::Empty:
+        if (!bVisited)
+        {
+            return GroundImage;
+        }
+
+        // Visited ground follows the color of the last collected point
+        if (CurrentPathLineColor == RedPointColor)
+        {
+            return VisitedGroundRedImage;
+        }
+        if (CurrentPathLineColor == GreenPointColor)
+        {
+            return VisitedGroundGreenImage;
+        }
+        if (CurrentPathLineColor == BluePointColor)
+        {
+            return VisitedGroundBlueImage;
+        }
+        return VisitedGroundImage;
+    default:
+        return nullptr;
+    }
+}
+
+FLinearColor UStrokeGrid::GetCellColor(EStrokeCellType CellType, int32 PortalID, bool bVisited) const
+{
+    if (bVisited && CellType != EStrokeCellType::Start)
+    {
+        return CurrentPathLineColor;
+    }
+
+    if (PortalID != -1)
+    {
+        return FLinearColor::White;
+    }
+
+    switch (CellType)
+    {
+    case EStrokeCellType::Start:
+        return StartPointColor;
+    case EStrokeCellType::Goal:
+        return GoalPointColor;
+    case EStrokeCellType::RedPoint:
+        return RedPointColor;
+    case EStrokeCellType::GreenPoint:
+        return GreenPointColor;
+    case EStrokeCellType::BluePoint:
+        return BluePointColor;
+    case EStrokeCellType::Wall:
+        return FLinearColor::Black;
+    case EStrokeCellType::Empty:
+    default:
+        return FLinearColor::White;
+    }
 }
 
 bool UStrokeGrid::IsPositionValid(FIntPoint Position) const
@@ -934,6 +1272,9 @@ void UStrokeGrid::ResetGame()
     CurrentPlayerPosition = CurrentPuzzle.StartPosition;
     VisitedPositions.Empty();
     VisitedRequiredPoints.Empty();
+    ResetProgressMasks();
+    ClearMoveHistory();
+    ReplayRecorder.RecordEvent(EPuzzleReplayEvent::Reset, FPlatformTime::Seconds());
     CurrentPathLineColor = DefaultPathLineColor;
 
     for (UStrokeCell* Cell : CellWidgets)
@@ -959,10 +1300,53 @@ void UStrokeGrid::ResetGame()
 
     OnProgressReset();
     UpdatePathDisplay();
+    RefreshBoard();
     UpdateProgressBar();
     SetKeyboardFocus();
 }
 
+void UStrokeGrid::RequestHint()
+{
+    if (!(bShowHints || CurrentPuzzle.bShowHints) || bEditMode || GameState != EStrokeGameState::Playing)
+    {
+        return;
+    }
+
+    if (!HintEngine || HintEngine->IsEnforcingRGBOrder() != bEnforceRGBOrder)
+    {
+        HintEngine = MakeShared<FStrokeHintEngine, ESPMode::ThreadSafe>(CurrentPuzzle, bEnforceRGBOrder);
+    }
+
+    FStrokeHintRequest Request;
+    Request.Position = CurrentPlayerPosition;
+    Request.VisitedPositions = VisitedPositions;
+    Request.CollectedPoints = VisitedRequiredPoints;
+
+    HintEngine->RequestHint(MoveTemp(Request), FStrokeHintEngine::FOnHintReady::CreateUObject(this, &UStrokeGrid::HandleHintReady));
+}
+
+void UStrokeGrid::HandleHintReady(EStrokeHintResult Result, FIntPoint Direction, const FStrokeHintRequest& Request)
+{
+    // The player may have moved on while the search was running
+    if (GameState != EStrokeGameState::Playing ||
+        Request.Position != CurrentPlayerPosition ||
+        Request.VisitedPositions.Num() != VisitedPositions.Num())
+    {
+        return;
+    }
+
+    OnHintReady(Result, Direction, CurrentPlayerPosition + Direction);
+}
+
+void UStrokeGrid::ResetHintEngine()
+{
+    if (HintEngine)
+    {
+        HintEngine->Cancel();
+        HintEngine.Reset();
+    }
+}
+
 void UStrokeGrid::PlaySound(USoundBase* Sound, float Volume)
 {
     if (bEnableSounds && Sound && GetWorld())
@@ -982,24 +1366,46 @@ bool UStrokeGrid::MovePlayer(FIntPoint Direction)
 
     PlaySound(MoveSound, MoveSoundVolume);
 
+    FIntPoint PreviousPosition = CurrentPlayerPosition;
+    FIntPoint TeleportEntry = NewPosition;
+    FLinearColor PreviousPathColor = CurrentPathLineColor;
+
+    FStrokeMoveDelta Delta;
+    Delta.From = int16(GridLayout.ToIndex(PreviousPosition));
+    Delta.Entry = int16(GridLayout.ToIndex(TeleportEntry));
+    Delta.To = int16(GridLayout.ToIndex(CheckTeleport(TeleportEntry)));
+    Delta.PriorVisited =
+        (IsCellMarkedVisited(PreviousPosition) ? FStrokeMoveDelta::FromVisited : 0) |
+        (IsCellMarkedVisited(TeleportEntry) ? FStrokeMoveDelta::EntryVisited : 0) |
+        (IsCellMarkedVisited(GridLayout.ToPosition(Delta.To)) ? FStrokeMoveDelta::ToVisited : 0);
+
     UStrokeCell* OldCell = GetCellAtPosition(CurrentPlayerPosition);
     if (OldCell)
     {
         OldCell->SetPlayerPresence(false);
-        OldCell->SetVisited(true);
     }
+    MarkCellVisited(CurrentPlayerPosition);
 
-    VisitedPositions.Add(CurrentPlayerPosition);
+    const int32 OldIndex = GridLayout.ToIndex(CurrentPlayerPosition);
+    const int32 PathIndex = VisitedPositions.Add(CurrentPlayerPosition);
+    if (PathIndexByCell.IsValidIndex(OldIndex))
+    {
+        PathIndexByCell[OldIndex] = PathIndex;
+    }
 
-    EStrokeCellType OldCellType = GetCellTypeAtPosition(CurrentPlayerPosition);
+    EStrokeCellType OldCellType = GridLayout.GetCellType(OldIndex);
     if (OldCellType == EStrokeCellType::RedPoint ||
         OldCellType == EStrokeCellType::GreenPoint ||
         OldCellType == EStrokeCellType::BluePoint)
     {
-        if (!VisitedRequiredPoints.Contains(CurrentPlayerPosition))
+        const int32 Slot = GridLayout.GetRequiredSlot(OldIndex);
+        if (VisitedRequiredMask.IsValidIndex(Slot) && !VisitedRequiredMask[Slot])
         {
+            VisitedRequiredMask[Slot] = true;
+            NumVisitedRequired++;
             VisitedRequiredPoints.Add(CurrentPlayerPosition);
             UpdatePathColor();
+            Delta.CollectedSlot = int8(Slot);
 
             if (OldCellType == EStrokeCellType::RedPoint)
             {
@@ -1024,19 +1430,9 @@ bool UStrokeGrid::MovePlayer(FIntPoint Direction)
     FIntPoint FinalPosition = CheckTeleport(CurrentPlayerPosition);
     if (FinalPosition != CurrentPlayerPosition)
     {
-        UStrokeCell* TeleportEntryCell = GetCellAtPosition(CurrentPlayerPosition);
-        if (TeleportEntryCell)
-        {
-            TeleportEntryCell->SetVisited(true);
-        }
-
+        MarkCellVisited(CurrentPlayerPosition);
         CurrentPlayerPosition = FinalPosition;
-
-        UStrokeCell* TeleportExitCell = GetCellAtPosition(CurrentPlayerPosition);
-        if (TeleportExitCell)
-        {
-            TeleportExitCell->SetVisited(true);
-        }
+        MarkCellVisited(CurrentPlayerPosition);
     }
 
     UStrokeCell* NewCell = GetCellAtPosition(CurrentPlayerPosition);
@@ -1045,13 +1441,186 @@ bool UStrokeGrid::MovePlayer(FIntPoint Direction)
         NewCell->SetPlayerPresence(true);
     }
 
-    UpdatePathDisplay();
+    // Path lines pick up the path color, so a color change still needs a full redraw
+    if (CurrentPathLineColor != PreviousPathColor)
+    {
+        UpdatePathDisplay();
+    }
+    else
+    {
+        const int32 PathLength = VisitedPositions.Num();
+        FIntPoint BeforePrevious = PathLength >= 2 ? VisitedPositions[PathLength - 2] : PreviousPosition;
+
+        const FIntPoint ChangedPositions[] = { BeforePrevious, PreviousPosition, TeleportEntry, CurrentPlayerPosition };
+        UpdatePathDisplayAt(ChangedPositions);
+    }
+
+    UndoStack.Add(Delta);
+    if (!bRedoingMove)
+    {
+        RedoStack.Reset();
+        ReplayRecorder.RecordMove(Direction, FPlatformTime::Seconds());
+    }
+
+    RefreshBoard();
     UpdateProgressBar();
     CheckWinCondition();
 
     return true;
 }
 
+bool UStrokeGrid::UndoMove()
+{
+    if (bEditMode || GameState != EStrokeGameState::Playing || UndoStack.Num() == 0)
+    {
+        return false;
+    }
+
+    const FStrokeMoveDelta Delta = UndoStack.Pop(EAllowShrinking::No);
+    RedoStack.Add(Delta);
+    ReplayRecorder.RecordEvent(EPuzzleReplayEvent::Undo, FPlatformTime::Seconds());
+
+    const FIntPoint FromPosition = GridLayout.ToPosition(Delta.From);
+    const FIntPoint EntryPosition = GridLayout.ToPosition(Delta.Entry);
+    const FIntPoint ToPosition = GridLayout.ToPosition(Delta.To);
+    const FLinearColor PreviousPathColor = CurrentPathLineColor;
+
+    if (UStrokeCell* PlayerCell = GetCellAtPosition(CurrentPlayerPosition))
+    {
+        PlayerCell->SetPlayerPresence(false);
+    }
+
+    // Reverse order of MovePlayer, so a teleport back onto From ends with From's own bit
+    MarkCellVisited(ToPosition, (Delta.PriorVisited & FStrokeMoveDelta::ToVisited) != 0);
+    MarkCellVisited(EntryPosition, (Delta.PriorVisited & FStrokeMoveDelta::EntryVisited) != 0);
+    MarkCellVisited(FromPosition, (Delta.PriorVisited & FStrokeMoveDelta::FromVisited) != 0);
+
+    VisitedPositions.Pop(EAllowShrinking::No);
+
+    // A teleport exit can be stepped off twice; MovePlayer keeps the latest path index
+    if (PathIndexByCell.IsValidIndex(Delta.From))
+    {
+        PathIndexByCell[Delta.From] = VisitedPositions.FindLast(FromPosition);
+    }
+
+    if (Delta.CollectedSlot != INDEX_NONE && VisitedRequiredMask.IsValidIndex(Delta.CollectedSlot))
+    {
+        VisitedRequiredMask[Delta.CollectedSlot] = false;
+        NumVisitedRequired--;
+        VisitedRequiredPoints.Pop(EAllowShrinking::No);
+        UpdatePathColor();
+    }
+
+    CurrentPlayerPosition = FromPosition;
+
+    if (UStrokeCell* PlayerCell = GetCellAtPosition(CurrentPlayerPosition))
+    {
+        PlayerCell->SetPlayerPresence(true);
+    }
+
+    if (CurrentPathLineColor != PreviousPathColor)
+    {
+        UpdatePathDisplay();
+    }
+    else
+    {
+        const FIntPoint NewLast = VisitedPositions.Num() > 0 ? VisitedPositions.Last() : FromPosition;
+        const FIntPoint ChangedPositions[] = { NewLast, FromPosition, EntryPosition, ToPosition };
+        UpdatePathDisplayAt(ChangedPositions);
+    }
+
+    RefreshBoard();
+    UpdateProgressBar();
+
+    return true;
+}
+
+bool UStrokeGrid::RedoMove()
+{
+    if (bEditMode || GameState != EStrokeGameState::Playing || RedoStack.Num() == 0)
+    {
+        return false;
+    }
+
+    const FStrokeMoveDelta Delta = RedoStack.Pop(EAllowShrinking::No);
+
+    TGuardValue<bool> RedoGuard(bRedoingMove, true);
+    if (!MovePlayer(GridLayout.ToPosition(Delta.Entry) - GridLayout.ToPosition(Delta.From)))
+    {
+        return false;
+    }
+
+    ReplayRecorder.RecordEvent(EPuzzleReplayEvent::Redo, FPlatformTime::Seconds());
+    return true;
+}
+
+void UStrokeGrid::StartReplayRecording()
+{
+    ReplayPlayer.Reset();
+    ResetGame();
+
+    FPuzzleReplayHeader Header;
+    Header.Source = EPuzzleReplaySource::StrokeGrid;
+    Header.StageHash = FPuzzleReplay::HashStage(CurrentPuzzle);
+    Header.GridSize = CurrentPuzzle.GridSize;
+    Header.StageName = CurrentStageRowName.ToString();
+
+    ReplayRecorder.Begin(Header, FPlatformTime::Seconds());
+}
+
+void UStrokeGrid::StopReplayRecording()
+{
+    ReplayRecorder.Stop();
+}
+
+bool UStrokeGrid::SaveReplay(const FString& FilePath) const
+{
+    return ReplayRecorder.SaveToFile(FilePath);
+}
+
+bool UStrokeGrid::PlayReplay(const FString& FilePath, float Speed)
+{
+    FPuzzleReplay Replay;
+    FString Error;
+
+    if (!FPuzzleReplay::LoadFromFile(FilePath, Replay, Error))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("StrokeGrid replay: %s"), *Error);
+        return false;
+    }
+
+    ReplayRecorder.Stop();
+    ResetGame();
+
+    ReplayPlayer = MakeShared<FPuzzleReplayPlayer>(MoveTemp(Replay));
+    if (!ReplayPlayer->Play(this, Speed, Error))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("StrokeGrid replay: %s"), *Error);
+        ReplayPlayer.Reset();
+        return false;
+    }
+
+    return true;
+}
+
+void UStrokeGrid::SaveCheckpoint()
+{
+    CheckpointDepth = UndoStack.Num();
+}
+
+bool UStrokeGrid::RestoreCheckpoint()
+{
+    while (UndoStack.Num() > CheckpointDepth)
+    {
+        if (!UndoMove())
+        {
+            break;
+        }
+    }
+
+    return UndoStack.Num() == CheckpointDepth;
+}
+
 
 void UStrokeGrid::OnGameWon()
 {
@@ -1,4 +1,5 @@
 #include "Save_Instance/Hamoina_GameInstance.h"
+#include "Core/LevelTransitionSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
@@ -280,16 +281,16 @@ FString UHamoina_GameInstance::GetCurrentDialogueID() const
 {
     if (CurrentSaveData)
     {
-        //   CurrentDialogueID Ȯ
+        // 먼저 저장된 CurrentDialogueID 확인
         FString SavedID = CurrentSaveData->GetCurrentDialogueID();
 
-        //  ID  װ ȯ
+        // 저장된 ID가 있으면 그걸 반환
         if (!SavedID.IsEmpty())
         {
             return SavedID;
         }
 
-        //    (Step )
+        // 없으면 기존 로직 (Step 기반)
         FString CurrentLevel = GetLevelNameFromStage(GetCurrentStageNumber());
         return CurrentSaveData->GetCurrentDialogueForLevel(CurrentLevel);
     }
@@ -477,6 +478,27 @@ int32 UHamoina_GameInstance::GetCurrentStageNumber() const
         return 1;
     }
 
+    // 레벨 이름(FName)별로 한 번만 계산
+    FName LevelKey = NAME_None;
+    if (ULevelTransitionSubsystem* LevelTransition = World->GetSubsystem<ULevelTransitionSubsystem>())
+    {
+        LevelKey = LevelTransition->GetCurrentLevelFName();
+        if (const int32* CachedStage = StageNumberCache.Find(LevelKey))
+        {
+            return *CachedStage;
+        }
+    }
+
+    const int32 Stage = ResolveStageNumber(World);
+    if (!LevelKey.IsNone())
+    {
+        StageNumberCache.Add(LevelKey, Stage);
+    }
+    return Stage;
+}
+
+int32 UHamoina_GameInstance::ResolveStageNumber(UWorld* World) const
+{
     FString MapName = World->GetMapName();
     FString WorldName = World->GetName();
     FString StreamingPrefix = World->StreamingLevelsPrefix;
@@ -709,7 +731,7 @@ void UHamoina_GameInstance::SetCurrentDialogueID(const FString& DialogueID)
     if (CurrentSaveData)
     {
         CurrentSaveData->SetCurrentDialogueID(DialogueID);
-        //    ̺
+        // 저장 후 즉시 세이브
         SaveContinueGame();
     }
 }
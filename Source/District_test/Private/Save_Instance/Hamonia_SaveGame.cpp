@@ -473,7 +473,7 @@ TArray<bool> UHamonia_SaveGame::GetHintBlockStates(int32 LevelNumber) const
         return State->RevealedBlocks;
     }
 
-    //  ʱ  ȯ
+    // 없으면 초기 상태 반환
     TArray<bool> EmptyState;
     EmptyState.SetNum(6);
     for (int32 i = 0; i < 6; i++)
@@ -515,7 +515,7 @@ float UHamonia_SaveGame::GetHintCooldownTime(int32 LevelNumber) const
     const FHintBlockState* State = HintData.LevelHintStates.Find(LevelNumber);
     if (State)
     {
-        //     ð 
+        // 마지막 저장 이후 경과 시간 계산
         FDateTime Now = FDateTime::Now();
         FTimespan TimeDiff = Now - State->LastSaveTime;
         float ElapsedTime = TimeDiff.GetTotalSeconds();
@@ -0,0 +1,479 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/DialogueManagerComponent.h"
+#include "Interaction/UStrokeGrid.h"
+#include "Gameplay/GridMazeManager.h"
+#include "Gameplay/GridTile.h"
+#include "Gameplay/MazeSimulation.h"
+#include "Save_Instance/Hamonia_SaveGame.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/UniformGridPanel.h"
+#include "Engine/DataTable.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/PlatformTime.h"
+
+// Timing tests for the puzzle hot paths, run in a transient game world:
+// stroke grid setup and moves for 5x5 to 30x30, grid maze creation/reset/steps,
+// dialogue lookups over synthetic tables and save game round trips.
+//
+// UnrealEditor-Cmd District_test.uproject -nullrhi -unattended -NoSound
+//     -ExecCmds="Automation RunTests District.Benchmarks; Quit"
+//     [-PuzzleBenchmarkBaseline=Dir] [-PuzzleBenchmarkTolerance=0.25] [-PuzzleBenchmarkIterations=N]
+//
+// Each test writes its results to Saved/Benchmarks/<Test>.csv. When the baseline directory
+// (Saved/Benchmarks/Baseline by default) holds a CSV of the same name from an earlier run,
+// the test fails for every benchmark whose median is slower than the baseline by more than Tolerance.
+namespace PuzzleBenchmark
+{
+    constexpr EAutomationTestFlags TestFlags = EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter;
+
+    struct FResult
+    {
+        FString Name;
+        int32 Iterations = 0;
+        double MedianMs = 0.0;
+        double MinMs = 0.0;
+    };
+
+    struct FContext
+    {
+        UWorld* World = nullptr;
+        int32 Iterations = 20;
+        TArray<FResult> Results;
+
+        // Setup runs before every iteration and is not timed. Body returns how many operations
+        // it performed, so per-move benchmarks report the time of a single move.
+        template <typename SetupType, typename BodyType>
+        void Measure(const FString& Name, SetupType&& Setup, BodyType&& Body)
+        {
+            TArray<double> Samples;
+            Samples.Reserve(Iterations);
+
+            // The first pass warms caches and pools and is discarded
+            for (int32 i = 0; i <= Iterations; i++)
+            {
+                Setup();
+
+                const double Start = FPlatformTime::Seconds();
+                const int32 Operations = FMath::Max(1, Body());
+                const double ElapsedMs = (FPlatformTime::Seconds() - Start) * 1000.0 / Operations;
+
+                if (i > 0)
+                {
+                    Samples.Add(ElapsedMs);
+                }
+            }
+
+            Samples.Sort();
+
+            FResult& Result = Results.AddDefaulted_GetRef();
+            Result.Name = Name;
+            Result.Iterations = Samples.Num();
+            Result.MedianMs = Samples[Samples.Num() / 2];
+            Result.MinMs = Samples[0];
+        }
+
+        template <typename BodyType>
+        void Measure(const FString& Name, BodyType&& Body)
+        {
+            Measure(Name, []() {}, Forward<BodyType>(Body));
+        }
+    };
+
+    FContext MakeContext()
+    {
+        FContext Context;
+        FParse::Value(FCommandLine::Get(), TEXT("PuzzleBenchmarkIterations="), Context.Iterations);
+        Context.Iterations = FMath::Max(1, Context.Iterations);
+        return Context;
+    }
+
+    bool LoadBaseline(const FString& Path, TMap<FString, double>& OutMedians)
+    {
+        TArray<FString> Lines;
+        if (!FFileHelper::LoadFileToStringArray(Lines, *Path))
+        {
+            return false;
+        }
+
+        for (int32 i = 1; i < Lines.Num(); i++)
+        {
+            TArray<FString> Columns;
+            Lines[i].ParseIntoArray(Columns, TEXT(","), false);
+            if (Columns.Num() >= 3)
+            {
+                OutMedians.Add(Columns[0], FCString::Atod(*Columns[2]));
+            }
+        }
+
+        return true;
+    }
+
+    // Writes the results to CSV and reports every benchmark that regressed against the baseline
+    // as a test error. Returns false when any did.
+    bool ReportResults(FAutomationTestBase& Test, const FString& TestName, const FContext& Context)
+    {
+        const FString BenchmarkDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmarks"));
+        const FString CsvName = TestName + TEXT(".csv");
+
+        FString BaselineDir = FPaths::Combine(BenchmarkDir, TEXT("Baseline"));
+        FParse::Value(FCommandLine::Get(), TEXT("PuzzleBenchmarkBaseline="), BaselineDir);
+
+        float Tolerance = 0.25f;
+        FParse::Value(FCommandLine::Get(), TEXT("PuzzleBenchmarkTolerance="), Tolerance);
+
+        TMap<FString, double> Baseline;
+        const FString BaselinePath = FPaths::Combine(BaselineDir, CsvName);
+        if (!LoadBaseline(BaselinePath, Baseline))
+        {
+            Test.AddInfo(FString::Printf(TEXT("No baseline at %s, recording results only"), *BaselinePath));
+        }
+
+        FString Csv = TEXT("Name,Iterations,MedianMs,MinMs,BaselineMs,Ratio,Status\n");
+        int32 Regressions = 0;
+
+        for (const FResult& Result : Context.Results)
+        {
+            const double* BaselineMs = Baseline.Find(Result.Name);
+            const double Ratio = BaselineMs && *BaselineMs > 0.0 ? Result.MedianMs / *BaselineMs : 0.0;
+
+            // Differences under 10 microseconds are timer noise
+            const bool bRegressed = BaselineMs && Ratio > 1.0 + Tolerance && Result.MedianMs - *BaselineMs > 0.01;
+            const TCHAR* Status = !BaselineMs ? TEXT("new") : bRegressed ? TEXT("REGRESSED") : TEXT("ok");
+
+            Test.AddInfo(FString::Printf(TEXT("%-48s median %10.4f ms  min %10.4f ms  %s"), *Result.Name, Result.MedianMs, Result.MinMs, Status));
+
+            if (bRegressed)
+            {
+                Regressions++;
+                Test.AddError(FString::Printf(TEXT("%s regressed, %.4f ms vs baseline %.4f ms"), *Result.Name, Result.MedianMs, *BaselineMs));
+            }
+
+            Csv += FString::Printf(TEXT("%s,%d,%.6f,%.6f,%.6f,%.3f,%s\n"), *Result.Name, Result.Iterations, Result.MedianMs, Result.MinMs,
+                BaselineMs ? *BaselineMs : 0.0, Ratio, Status);
+        }
+
+        const FString CsvPath = FPaths::Combine(BenchmarkDir, CsvName);
+        if (!FFileHelper::SaveStringToFile(Csv, *CsvPath))
+        {
+            Test.AddWarning(FString::Printf(TEXT("Could not write %s"), *CsvPath));
+        }
+
+        return Regressions == 0;
+    }
+
+    // Boustrophedon walk over a Rows x Columns grid, starting at (0, 0)
+    TArray<FIntPoint> MakeSerpentine(int32 Rows, int32 Columns)
+    {
+        TArray<FIntPoint> Path;
+        Path.Reserve(Rows * Columns);
+
+        for (int32 X = 0; X < Rows; X++)
+        {
+            for (int32 i = 0; i < Columns; i++)
+            {
+                Path.Add(FIntPoint(X, (X % 2 == 0) ? i : Columns - 1 - i));
+            }
+        }
+
+        return Path;
+    }
+
+    UWorld* CreateWorld()
+    {
+        UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("PuzzleBenchmarkWorld"));
+        FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+        WorldContext.SetCurrentWorld(World);
+
+        World->InitializeActorsForPlay(FURL());
+        World->BeginPlay();
+        return World;
+    }
+
+    void DestroyWorld(UWorld* World)
+    {
+        GEngine->DestroyWorldContext(World);
+        World->DestroyWorld(false);
+    }
+
+    UStrokeGrid* CreateStrokeGrid(UWorld* World)
+    {
+        UStrokeGrid* Grid = CreateWidget<UStrokeGrid>(World, UStrokeGrid::StaticClass());
+
+        // The native class has no designer tree, so give it the panel BindWidget would provide
+        Grid->GridPanel = Grid->WidgetTree->ConstructWidget<UUniformGridPanel>(UUniformGridPanel::StaticClass());
+        Grid->WidgetTree->RootWidget = Grid->GridPanel;
+        Grid->bEnableSounds = false;
+        return Grid;
+    }
+
+    AGridMazeManager* SpawnMaze(UWorld* World, int32 Size, bool bBatched)
+    {
+        AGridMazeManager* Maze = World->SpawnActorDeferred<AGridMazeManager>(AGridMazeManager::StaticClass(), FTransform::Identity);
+        Maze->GridRows = Size;
+        Maze->GridColumns = Size;
+        Maze->TileClass = AGridTile::StaticClass();
+        Maze->bUseBatchedTiles = bBatched;
+        Maze->bEnablePreview = false;
+        Maze->bUseStartingFloor = false;
+        Maze->bAutoFindDisplay = false;
+        Maze->CorrectPath = MakeSerpentine(Size, Size);
+        Maze->FinishSpawning(FTransform::Identity);
+        return Maze;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPuzzleBenchmarkStrokeGridTest, "District.Benchmarks.StrokeGrid", PuzzleBenchmark::TestFlags)
+
+bool FPuzzleBenchmarkStrokeGridTest::RunTest(const FString& Parameters)
+{
+    using namespace PuzzleBenchmark;
+
+    static const int32 Sizes[] = { 5, 10, 15, 20, 25, 30 };
+
+    FContext Context = MakeContext();
+    Context.World = CreateWorld();
+
+    for (int32 Size : Sizes)
+    {
+        const TArray<FIntPoint> Path = MakeSerpentine(Size, Size);
+
+        FStrokePuzzleData Puzzle;
+        Puzzle.GridSize = FIntPoint(Size, Size);
+        Puzzle.StartPosition = Path[0];
+        Puzzle.GoalPosition = Path.Last();
+        Puzzle.RequiredPoints = { Path[Path.Num() / 4], Path[Path.Num() / 2], Path[Path.Num() * 3 / 4] };
+        Puzzle.WallPositions.Reset();
+        Puzzle.TeleportPortals.Reset();
+
+        const FString Suffix = FString::Printf(TEXT("%dx%d"), Size, Size);
+
+        Context.Measure(TEXT("StrokeGrid.InitializeGrid.Cold.") + Suffix, [&]()
+        {
+            UStrokeGrid* Fresh = CreateStrokeGrid(Context.World);
+            Fresh->InitializeGrid(Puzzle);
+            return 1;
+        });
+
+        UStrokeGrid* Grid = CreateStrokeGrid(Context.World);
+        Grid->InitializeGrid(Puzzle);
+
+        Context.Measure(TEXT("StrokeGrid.InitializeGrid.Warm.") + Suffix, [&]()
+        {
+            Grid->InitializeGrid(Puzzle);
+            return 1;
+        });
+
+        Context.Measure(TEXT("StrokeGrid.CreateCells.") + Suffix, [&]()
+        {
+            Grid->CreateCells();
+            return 1;
+        });
+
+        // Stops one short of the goal so the win timers never start
+        auto WalkPath = [&]()
+        {
+            int32 Moves = 0;
+            for (int32 i = 1; i < Path.Num() - 1; i++)
+            {
+                Moves += Grid->MovePlayer(Path[i] - Path[i - 1]) ? 1 : 0;
+            }
+            return Moves;
+        };
+
+        Context.Measure(TEXT("StrokeGrid.MovePlayer.") + Suffix, [&]() { Grid->ResetGame(); }, WalkPath);
+
+        Grid->bUseBoardRenderer = true;
+        Grid->InitializeGrid(Puzzle);
+
+        Context.Measure(TEXT("StrokeGrid.MovePlayer.Board.") + Suffix, [&]() { Grid->ResetGame(); }, WalkPath);
+    }
+
+    DestroyWorld(Context.World);
+    return ReportResults(*this, TEXT("StrokeGrid"), Context);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPuzzleBenchmarkGridMazeTest, "District.Benchmarks.GridMaze", PuzzleBenchmark::TestFlags)
+
+bool FPuzzleBenchmarkGridMazeTest::RunTest(const FString& Parameters)
+{
+    using namespace PuzzleBenchmark;
+
+    static const int32 Sizes[] = { 4, 8, 16, 30 };
+
+    // The manager logs every step; those lines are part of what is timed, not test warnings
+    AddExpectedError(TEXT("Tile Stepped|Stepped: |CurrentPathIndex: |Expected: |Result: "), EAutomationExpectedErrorFlags::Contains, 0);
+
+    FContext Context = MakeContext();
+    Context.World = CreateWorld();
+
+    for (int32 Size : Sizes)
+    {
+        for (bool bBatched : { false, true })
+        {
+            const FString Suffix = FString::Printf(TEXT("%s%dx%d"), bBatched ? TEXT("Batched.") : TEXT(""), Size, Size);
+            AGridMazeManager* Maze = SpawnMaze(Context.World, Size, bBatched);
+
+            Context.Measure(TEXT("GridMaze.CreateGrid.") + Suffix, [&]()
+            {
+                Maze->CreateGrid();
+                return 1;
+            });
+
+            Context.Measure(TEXT("GridMaze.ResetPuzzle.") + Suffix, [&]()
+            {
+                Maze->ResetPuzzle();
+                return 1;
+            });
+
+            // The first step only starts the puzzle, so it is part of the setup
+            const TArray<FIntPoint> Path = Maze->CorrectPath;
+            Context.Measure(TEXT("GridMaze.OnTileStep.") + Suffix, [&]()
+            {
+                Maze->CompleteReset();
+                Maze->OnCellStep(Path[0], nullptr);
+            },
+            [&]()
+            {
+                for (const FIntPoint& Cell : Path)
+                {
+                    if (AGridTile* Tile = Maze->GetTileAt(Cell.X, Cell.Y))
+                    {
+                        Maze->OnTileStep(Tile, nullptr);
+                    }
+                    else
+                    {
+                        Maze->OnCellStep(Cell, nullptr);
+                    }
+                }
+                return Path.Num();
+            });
+
+            Maze->Destroy();
+        }
+
+        // The same steps against the rules alone, without tiles, sounds, logging or Blueprint events
+        const TArray<FIntPoint> Path = MakeSerpentine(Size, Size);
+        FMazeSimulation Simulation;
+        Simulation.SetLayout(Size, Size, Path);
+
+        Context.Measure(FString::Printf(TEXT("GridMaze.Simulation.Step.%dx%d"), Size, Size), [&]()
+        {
+            Simulation.Reset();
+            Simulation.ClearProgress();
+            Simulation.Start();
+            Simulation.ClearEvents();
+        },
+        [&]()
+        {
+            for (const FIntPoint& Cell : Path)
+            {
+                Simulation.Step(Cell);
+            }
+            return Path.Num();
+        });
+    }
+
+    DestroyWorld(Context.World);
+    return ReportResults(*this, TEXT("GridMaze"), Context);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPuzzleBenchmarkDialogueTest, "District.Benchmarks.Dialogue", PuzzleBenchmark::TestFlags)
+
+bool FPuzzleBenchmarkDialogueTest::RunTest(const FString& Parameters)
+{
+    using namespace PuzzleBenchmark;
+
+    static const int32 RowCounts[] = { 1000, 10000, 50000 };
+
+    FContext Context = MakeContext();
+
+    for (int32 RowCount : RowCounts)
+    {
+        UDataTable* Table = NewObject<UDataTable>(GetTransientPackage());
+        Table->RowStruct = FDialogueData::StaticStruct();
+
+        for (int32 i = 0; i < RowCount; i++)
+        {
+            FDialogueData Row;
+            Row.DialogueID = FString::Printf(TEXT("BENCH_%06d"), i);
+            Row.LevelName = FString::Printf(TEXT("Level_%d"), i % 8);
+            Row.NextDialogueID = FString::Printf(TEXT("BENCH_%06d"), i + 1);
+            Table->AddRow(FName(*Row.DialogueID), Row);
+        }
+
+        UDialogueManagerComponent* Dialogue = NewObject<UDialogueManagerComponent>(GetTransientPackage());
+
+        TArray<FString> Lookups;
+        FRandomStream Random(RowCount);
+        for (int32 i = 0; i < 10000; i++)
+        {
+            // One in ten misses, like lookups of IDs from other levels
+            const int32 Id = Random.RandRange(0, RowCount + RowCount / 10);
+            Lookups.Add(FString::Printf(TEXT("BENCH_%06d"), Id));
+        }
+
+        const FString Suffix = FString::Printf(TEXT("%d"), RowCount);
+
+        // Assigning a different table rebuilds the index
+        Context.Measure(TEXT("Dialogue.BuildIndex.") + Suffix, [&]() { Dialogue->SetDialogueDataTable(nullptr); }, [&]()
+        {
+            Dialogue->SetDialogueDataTable(Table);
+            return 1;
+        });
+
+        // IsDialogueLocked is a plain index lookup with no side effects
+        Context.Measure(TEXT("Dialogue.Lookup.") + Suffix, [&]()
+        {
+            for (const FString& Id : Lookups)
+            {
+                Dialogue->IsDialogueLocked(Id);
+            }
+            return Lookups.Num();
+        });
+    }
+
+    return ReportResults(*this, TEXT("Dialogue"), Context);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPuzzleBenchmarkSaveGameTest, "District.Benchmarks.SaveGame", PuzzleBenchmark::TestFlags)
+
+bool FPuzzleBenchmarkSaveGameTest::RunTest(const FString& Parameters)
+{
+    using namespace PuzzleBenchmark;
+
+    static const int32 EntryCounts[] = { 10, 1000 };
+
+    FContext Context = MakeContext();
+
+    for (int32 EntryCount : EntryCounts)
+    {
+        UHamonia_SaveGame* Save = Cast<UHamonia_SaveGame>(UGameplayStatics::CreateSaveGameObject(UHamonia_SaveGame::StaticClass()));
+
+        for (int32 i = 0; i < EntryCount; i++)
+        {
+            Save->AddItem(FString::Printf(TEXT("Item_%d"), i), i % 5 + 1);
+            Save->AddNote(FString::Printf(TEXT("Note_%d"), i));
+            Save->SetLevelStep(FString::Printf(TEXT("Level_%d"), i), i);
+        }
+
+        Context.Measure(FString::Printf(TEXT("SaveGame.RoundTrip.%d"), EntryCount), [&]()
+        {
+            TArray<uint8> Bytes;
+            UGameplayStatics::SaveGameToMemory(Save, Bytes);
+            return UGameplayStatics::LoadGameFromMemory(Bytes) ? 1 : 0;
+        });
+    }
+
+    return ReportResults(*this, TEXT("SaveGame"), Context);
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
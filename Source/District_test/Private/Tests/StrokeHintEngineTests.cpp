@@ -0,0 +1,88 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/StrokeHintEngine.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+
+namespace StrokeHintEngineTests
+{
+    // 30x30 grid whose odd rows are walls with one gap at alternating ends, so the only way from
+    // (0, 0) to the goal is a single 463-move corridor and the search runs that deep
+    FStrokePuzzleData MakeCorridorPuzzle()
+    {
+        FStrokePuzzleData Puzzle;
+        Puzzle.GridSize = FIntPoint(30, 30);
+        Puzzle.StartPosition = FIntPoint(0, 0);
+        Puzzle.GoalPosition = FIntPoint(28, 29);
+        Puzzle.RequiredPoints.Reset();
+        Puzzle.WallPositions.Reset();
+        Puzzle.TeleportPortals.Reset();
+
+        for (int32 X = 1; X < 30; X += 2)
+        {
+            const int32 Gap = (X % 4 == 1) ? 29 : 0;
+            for (int32 Y = 0; Y < 30; Y++)
+            {
+                if (Y != Gap)
+                {
+                    Puzzle.WallPositions.Add(FIntPoint(X, Y));
+                }
+            }
+        }
+
+        return Puzzle;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStrokeHintEngineLargeGridTest, "District.Stroke.HintEngine.LargeGrid",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FStrokeHintEngineLargeGridTest::RunTest(const FString& Parameters)
+{
+    using namespace StrokeHintEngineTests;
+
+    // The search runs on a thread pool worker, whose stack is far smaller than the game thread's
+    TSharedRef<FStrokeHintEngine, ESPMode::ThreadSafe> Engine = MakeShared<FStrokeHintEngine, ESPMode::ThreadSafe>(MakeCorridorPuzzle(), false);
+
+    bool bAnswered = false;
+    bool bAnsweredOnGameThread = false;
+    EStrokeHintResult HintResult = EStrokeHintResult::Unknown;
+    FIntPoint HintDirection = FIntPoint::ZeroValue;
+
+    FStrokeHintRequest Request;
+    Request.Position = FIntPoint(0, 0);
+
+    Engine->RequestHint(Request, FStrokeHintEngine::FOnHintReady::CreateLambda(
+        [&](EStrokeHintResult Result, FIntPoint Direction, const FStrokeHintRequest&)
+        {
+            bAnswered = true;
+            bAnsweredOnGameThread = IsInGameThread();
+            HintResult = Result;
+            HintDirection = Direction;
+        }));
+
+    const double Deadline = FPlatformTime::Seconds() + 60.0;
+    while (!bAnswered && FPlatformTime::Seconds() < Deadline)
+    {
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FPlatformProcess::Sleep(0.001f);
+    }
+
+    if (!TestTrue(TEXT("Hint answered within 60 seconds"), bAnswered))
+    {
+        Engine->Cancel();
+        return false;
+    }
+
+    TestTrue(TEXT("Hint delivered on the game thread"), bAnsweredOnGameThread);
+    TestTrue(TEXT("Hint is a move"), HintResult == EStrokeHintResult::Move);
+    TestTrue(TEXT("Hint moves along the first corridor"), HintDirection == FIntPoint(0, 1));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
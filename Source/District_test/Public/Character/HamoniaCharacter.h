@@ -8,6 +8,7 @@
 #include "Gameplay/PuzzleInteractionComponent.h" 
 #include "Gameplay/Pedestal.h"
 #include "Interaction/InteractionEnums.h"
+#include "Interaction/InteractionFocusSubsystem.h"
 #include "Character/Unia.h"
 #include "Core/DialogueManagerComponent.h" 
 #include "HamoniaCharacter.generated.h"
@@ -50,7 +51,7 @@ public:
     UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "Components")
     USceneComponent* HeldObjectAttachPoint;
 
-    // DataTable 
+    // DataTable 설정용
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default Dialogue")
     UDataTable* DefaultDialogueDataTable;
 
@@ -116,6 +117,15 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction")
     float InteractionDistance = 400.0f;
 
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction|Focus", meta = (ClampMin = "0.0"))
+    float FocusRefreshInterval = 0.1f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction|Focus", meta = (ClampMin = "0.0"))
+    float FocusMoveThreshold = 5.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction|Focus", meta = (ClampMin = "0.0", ClampMax = "180.0"))
+    float FocusAngleThreshold = 1.0f;
+
 
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Inventory")
     UInputAction* InventoryToggleAction;
@@ -185,6 +195,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Interaction")
     void CheckForInteractables();
 
+    UFUNCTION(BlueprintCallable, Category = "Interaction")
+    void RequestInteractionFocusRefresh();
+
 
     UFUNCTION(BlueprintCallable, Category = "Interaction")
     void RotateObject();
@@ -298,6 +311,13 @@ protected:
 private:
     bool bIsSprinting = false;
 
+    FInteractionFocusViewState FocusViewState;
+
+    void UpdateInteractionFocus();
+    AActor* FindInteractionTarget(AActor* HeldObject);
+    void SetInteractionFocus(AActor* NewFocus);
+    UInteractionFocusSubsystem* GetFocusSubsystem() const;
+
     APedestal* FindPedestalFromActor(AActor* Actor);
 
     void SetupEnhancedInput();
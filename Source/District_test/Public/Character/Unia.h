@@ -25,6 +25,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	virtual void Tick(float DeltaTime) override;
@@ -196,11 +197,18 @@ protected:
 	void FindPlayerPawn();
 	void InitializeLevelSettings();
 	void CheckSpotArrival();
+	void HandleLevelChanged(FName NewLevelName, FName OldLevelName);
 
 private:
 	AUniaWaitSpot* FindWaitSpot(const FString& SpotID);
 	
 	FString CurrentTargetSpotID;
+	TWeakObjectPtr<AUniaWaitSpot> CurrentTargetSpot;
 	FTimerHandle SpotCheckTimer;
 	FString CurrentLevelName;
+	FDelegateHandle LevelChangedHandle;
+
+	// Native tick work only runs while the player is in range, so tick starts disabled and the
+	// interaction sphere toggles it. Blueprint subclasses that implement Event Tick tick always.
+	bool bHasBlueprintTick = false;
 };
\ No newline at end of file
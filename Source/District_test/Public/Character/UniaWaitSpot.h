@@ -8,6 +8,8 @@ class DISTRICT_TEST_API AUniaWaitSpot : public AActor
     GENERATED_BODY()
 public:
     AUniaWaitSpot();
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Wait Spot")
     FString SpotID = TEXT("WaitSpot_001");
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Wait Spot")
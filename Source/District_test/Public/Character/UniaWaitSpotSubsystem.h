@@ -0,0 +1,37 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UniaWaitSpotSubsystem.generated.h"
+
+class AUniaWaitSpot;
+
+UCLASS()
+class DISTRICT_TEST_API UUniaWaitSpotSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+public:
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+    void RegisterWaitSpot(AUniaWaitSpot* WaitSpot);
+    void UnregisterWaitSpot(AUniaWaitSpot* WaitSpot);
+
+    UFUNCTION(BlueprintCallable, Category = "Wait Spot")
+    AUniaWaitSpot* FindWaitSpot(const FString& SpotID);
+
+    FString GetCurrentLevelName() const;
+
+    UFUNCTION(BlueprintPure, Category = "Wait Spot")
+    int32 GetRegisteredSpotCount() const { return RegisteredSpotIDs.Num(); }
+
+private:
+    void HandleLevelChanged(FName NewLevelName, FName OldLevelName);
+
+    TMap<FString, TArray<TWeakObjectPtr<AUniaWaitSpot>>> SpotsByID;
+    TMap<TPair<FName, FString>, TWeakObjectPtr<AUniaWaitSpot>> ResolvedSpots;
+
+    // The SpotsByID key each spot was registered under; SpotID is editable, so it may have changed since
+    TMap<TWeakObjectPtr<AUniaWaitSpot>, FString> RegisteredSpotIDs;
+
+    FDelegateHandle LevelChangedHandle;
+};
@@ -0,0 +1,87 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameFramework/Actor.h"
+#include "UObject/ObjectKey.h"
+#include "ActorRegistrySubsystem.generated.h"
+
+// Per-class sets of live actors. Actors register themselves when their components are
+// registered (editor and game worlds alike), so lookups don't need a full actor iteration.
+UCLASS()
+class DISTRICT_TEST_API UActorRegistrySubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    static UActorRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+    // Helpers for actors to call from PostRegisterAllComponents / PostUnregisterAllComponents
+    static void AddActor(AActor* Actor);
+    static void RemoveActor(AActor* Actor);
+
+    void RegisterActor(AActor* Actor);
+    void UnregisterActor(AActor* Actor);
+
+    // Visits registered actors of T (including subclasses). Tag / Owner are optional filters.
+    // Return false from the callback to stop early.
+    template<typename T, typename FuncType>
+    void ForEachActor(FuncType&& Func, FName Tag = NAME_None, const AActor* Owner = nullptr) const
+    {
+        const TSet<TWeakObjectPtr<AActor>>* Actors = ActorsByClass.Find(T::StaticClass());
+        if (!Actors)
+        {
+            return;
+        }
+
+        for (const TWeakObjectPtr<AActor>& WeakActor : *Actors)
+        {
+            AActor* Actor = WeakActor.Get();
+            if (!IsValid(Actor) || !MatchesFilter(Actor, Tag, Owner))
+            {
+                continue;
+            }
+
+            if (!Func(static_cast<T*>(Actor)))
+            {
+                return;
+            }
+        }
+    }
+
+    template<typename T>
+    T* FindFirstActor(FName Tag = NAME_None, const AActor* Owner = nullptr) const
+    {
+        T* Found = nullptr;
+        ForEachActor<T>([&Found](T* Actor)
+        {
+            Found = Actor;
+            return false;
+        }, Tag, Owner);
+        return Found;
+    }
+
+    template<typename T>
+    void GetActors(TArray<T*>& OutActors, FName Tag = NAME_None, const AActor* Owner = nullptr) const
+    {
+        ForEachActor<T>([&OutActors](T* Actor)
+        {
+            OutActors.Add(Actor);
+            return true;
+        }, Tag, Owner);
+    }
+
+    UFUNCTION(BlueprintCallable, Category = "Actor Registry", meta = (DeterminesOutputType = "ActorClass", DynamicOutputParam = "OutActors"))
+    void GetRegisteredActors(TSubclassOf<AActor> ActorClass, FName Tag, AActor* Owner, TArray<AActor*>& OutActors) const;
+
+    UFUNCTION(BlueprintPure, Category = "Actor Registry")
+    int32 GetRegisteredActorCount(TSubclassOf<AActor> ActorClass) const;
+
+private:
+    static bool MatchesFilter(const AActor* Actor, FName Tag, const AActor* Owner);
+
+    // Keyed by every class in the actor's hierarchy below AActor, so base-class lookups
+    // see Blueprint subclasses too
+    TMap<TObjectKey<UClass>, TSet<TWeakObjectPtr<AActor>>> ActorsByClass;
+};
@@ -0,0 +1,68 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AnimationSchedulerSubsystem.generated.h"
+
+// Runs small per-object animations (blinks, pulses, countdowns) from a single world tick,
+// so actors and widgets can leave their own tick disabled while idle.
+UCLASS()
+class DISTRICT_TEST_API UAnimationSchedulerSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Receives a 0..1 sine factor for blinks, or the remaining seconds for countdowns
+    using FApplyFunc = TFunction<void(float)>;
+    using FFinishedFunc = TFunction<void()>;
+
+    virtual void Deinitialize() override;
+
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+    virtual bool IsTickable() const override;
+
+    static UAnimationSchedulerSubsystem* Get(const UObject* WorldContextObject);
+
+    // Duration <= 0 blinks until stopped
+    int32 StartBlink(UObject* Owner, float Speed, float Duration, FApplyFunc Apply, FFinishedFunc OnFinished = nullptr);
+
+    int32 StartCountdown(UObject* Owner, float Duration, FApplyFunc Apply, FFinishedFunc OnFinished = nullptr);
+
+    // Stops without calling OnFinished and resets the handle
+    void Stop(int32& Handle);
+
+    bool IsRunning(int32 Handle) const;
+
+    UFUNCTION(BlueprintPure, Category = "Animation Scheduler")
+    int32 GetActiveAnimationCount() const { return Animations.Num() + PendingAnimations.Num(); }
+
+private:
+    enum class EAnimationKind : uint8
+    {
+        Blink,
+        Countdown
+    };
+
+    struct FScheduledAnimation
+    {
+        int32 Handle = INDEX_NONE;
+        EAnimationKind Kind = EAnimationKind::Blink;
+        TWeakObjectPtr<UObject> Owner;
+        float Elapsed = 0.0f;
+        float Duration = 0.0f;
+        float Speed = 0.0f;
+        bool bStopped = false;
+        FApplyFunc Apply;
+        FFinishedFunc OnFinished;
+    };
+
+    int32 AddAnimation(EAnimationKind Kind, UObject* Owner, float Speed, float Duration, FApplyFunc&& Apply, FFinishedFunc&& OnFinished);
+
+    TArray<FScheduledAnimation> Animations;
+
+    // Started from inside Tick; merged once the update loop is done
+    TArray<FScheduledAnimation> PendingAnimations;
+
+    int32 NextHandle = 1;
+    bool bIsTicking = false;
+};
@@ -127,11 +127,15 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue Settings")
     UDataTable* DialogueDataTable;
 
+    UFUNCTION(BlueprintCallable, Category = "Dialogue Settings")
+    void SetDialogueDataTable(UDataTable* NewTable);
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
     bool bIsInDialogue = false;
 
@@ -219,9 +223,21 @@ protected:
     bool ValidateSubStepRequirement(const FDialogueData& DialogueData);
 
     FDialogueData* GetCurrentDialogueData();
+
+    void EnsureDialogueIndex();
+    void BuildDialogueIndex();
+    void InvalidateDialogueIndex();
+    const TArray<FDialogueData*>* FindIndexedDialogues(const FString& LevelName, EDialogueCategory Category);
+
 private:
     FDialogueData CurrentDialogue;
 
+    TMap<FString, FDialogueData*> DialogueIndex;
+    TMap<TPair<FString, EDialogueCategory>, TArray<FDialogueData*>> LevelCategoryIndex;
+    TWeakObjectPtr<UDataTable> IndexedTable;
+    FDelegateHandle TableChangedHandle;
+    bool bDialogueIndexDirty = true;
+
     UPROPERTY()
     class ALevelQuestManager* CachedQuestManager;
 
@@ -28,7 +28,7 @@ protected:
     ALevelQuestManager* QuestManagerRef;
 
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Quest Info", meta = (MultiLine = "true"))
-    FString CurrentLevelInfo = "  ҷ ...";
+    FString CurrentLevelInfo = "레벨 정보를 불러오는 중...";
 
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Quest Info")
     TArray<FString> CurrentSubSteps;
@@ -3,7 +3,7 @@
 #include "GameFramework/GameModeBase.h"
 #include "HamoniaGameMode.generated.h"
 
-//  
+// 전방 선언
 class ALevelQuestManager;
 
 UCLASS()
@@ -17,13 +17,13 @@ public:
     virtual void StartPlay() override;
     virtual AActor* FindPlayerStart_Implementation(AController* Player, const FString& IncomingName) override;
 
-    // === Ʈ ý ߰ ===
+    // === 퀘스트 시스템 추가 ===
 
-    // Ʈ Ŵ
+    // 퀘스트 매니저
     UPROPERTY(BlueprintReadWrite, Category = "Quest")
     ALevelQuestManager* QuestManager;
 
-    // Ʈ  Լ (Ʈ  )
+    // 퀘스트 관련 함수들 (블루프린트에서 쉽게 사용)
     UFUNCTION(BlueprintCallable, Category = "Quest")
     void CompleteLevel();
 
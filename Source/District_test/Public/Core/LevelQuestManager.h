@@ -1,4 +1,4 @@
-// LevelQuestManager.h - ּ  
+// LevelQuestManager.h - 최소한 수정 버전
 #pragma once
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
@@ -21,15 +21,15 @@ struct FLevelInfo : public FTableRowBase
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     FString LumiDialogueID;
 
-    //  Ʈ 
+    // 메인 퀘스트 설명
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     FString Description;
 
-    //  ǥ ߰
+    // 메인 목표 추가
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     FString MainObjective;
 
-    // Ҹǥ 迭 ( )
+    // 소목표 배열 (순차적으로 진행)
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     TArray<FString> SubSteps;
 
@@ -40,7 +40,7 @@ struct FLevelInfo : public FTableRowBase
         LumiDialogueID = "";
         Description = "";
         MainObjective = "";
-        SubSteps = {};  //  迭 ʱȭ
+        SubSteps = {};  // 빈 배열로 초기화
     }
 };
 
@@ -51,6 +51,9 @@ class DISTRICT_TEST_API ALevelQuestManager : public AActor
 
 public:
     virtual void BeginPlay() override;
+    virtual void PostRegisterAllComponents() override;
+    virtual void PostUnregisterAllComponents() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     ALevelQuestManager();
 
 
@@ -60,27 +63,27 @@ public:
     UFUNCTION(BlueprintCallable)
     int32 GetCurrentSubStep();
 
-    //  ̺ -  Ϳ  
+    // 데이터 테이블 - 이제 에디터에서 설정 가능
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quest")
     UDataTable* LevelDataTable;
 
-    // ڵ   
+    // 자동 맵 감지 여부
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quest")
     bool bAutoDetectLevel = true;
 
-    //  
+    // 현재 레벨
     UPROPERTY(BlueprintReadWrite, Category = "Quest")
     FString CurrentLevel;
 
-    // Ϸ 
+    // 완료된 레벨들
     UPROPERTY(BlueprintReadWrite, Category = "Quest")
     TArray<FString> CompletedLevels;
 
-    //  Ҹǥ Ϸ 
+    // 각 소목표 완료 상태
     UPROPERTY(BlueprintReadWrite, Category = "Quest")
     TArray<bool> SubStepCompletionStatus;
 
-    // ===  ٽ  ===
+    // === 기존 핵심 기능 ===
     UFUNCTION(BlueprintCallable)
     void StartLevel(const FString& LevelID);
 
@@ -102,38 +105,38 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Quest")
     void RefreshForCurrentLevel();
 
-    // === Ҹǥ ý Լ ===
+    // === 소목표 시스템 함수들 ===
     UFUNCTION(BlueprintCallable)
     FString GetCurrentMainObjective();
 
     UFUNCTION(BlueprintCallable)
-    bool HasSubSteps();  //   Ҹǥ ִ
+    bool HasSubSteps();  // 현재 레벨에 소목표가 있는지
 
     UFUNCTION(BlueprintCallable)
-    FString GetCurrentLevelName();  //   ̸
+    FString GetCurrentLevelName();  // 현재 레벨 이름
 
     UFUNCTION(BlueprintCallable)
-    bool IsCurrentLevelCompleted();  //   Ϸ 
+    bool IsCurrentLevelCompleted();  // 현재 레벨 완료 여부
 
-    // ο Լ ߰
+    // 새로운 함수들 추가
     UFUNCTION(BlueprintCallable)
-    void CompleteSubStep(int32 StepIndex);  // Ư ܰ Ϸ
+    void CompleteSubStep(int32 StepIndex);  // 특정 단계 완료
 
     UFUNCTION(BlueprintCallable)
-    bool IsSubStepCompleted(int32 StepIndex);  // Ư ܰ Ϸ 
+    bool IsSubStepCompleted(int32 StepIndex);  // 특정 단계 완료 여부
 
     UFUNCTION(BlueprintCallable)
-    TArray<bool> GetAllSubStepStatus();  //  ܰ Ϸ 
+    TArray<bool> GetAllSubStepStatus();  // 모든 단계 완료 상태
 
     UFUNCTION(BlueprintCallable)
-    int32 GetSubStepCount();  //  Ҹǥ 
+    int32 GetSubStepCount();  // 총 소목표 개수
 
     UFUNCTION(BlueprintCallable)
-    TArray<FString> GetAllSubStepTexts();  //  Ҹǥ ؽƮ
-
-    virtual void Tick(float DeltaTime) override;
+    TArray<FString> GetAllSubStepTexts();  // 모든 소목표 텍스트
 
 private:
+    void HandleLevelChanged(FName NewLevelName, FName OldLevelName);
 
     FString LastLoadedLevel;
+    FDelegateHandle LevelChangedHandle;
 };
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "LevelTransitionSubsystem.generated.h"
+
+class ULevel;
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnLevelNameChanged, FName /*NewLevelName*/, FName /*OldLevelName*/);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLevelNameChangedBP, FName, NewLevelName, FName, OldLevelName);
+
+// Resolves the persistent map name once per world and notifies listeners when it changes,
+// so actors don't have to poll GetMapName() from Tick.
+UCLASS()
+class DISTRICT_TEST_API ULevelTransitionSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+    UFUNCTION(BlueprintPure, Category = "Level Transition")
+    FName GetCurrentLevelFName();
+
+    const FString& GetCurrentLevelName();
+
+    FOnLevelNameChanged& OnLevelChanged() { return LevelChangedEvent; }
+
+    UPROPERTY(BlueprintAssignable, Category = "Level Transition")
+    FOnLevelNameChangedBP OnLevelChangedBP;
+
+    static ULevelTransitionSubsystem* Get(const UObject* WorldContextObject);
+    static FString GetLevelNameFor(const UObject* WorldContextObject);
+
+private:
+    void HandleLevelAdded(ULevel* Level, UWorld* InWorld);
+    void HandleLevelRemoved(ULevel* Level, UWorld* InWorld);
+    void RefreshLevelName(bool bBroadcast);
+
+    FOnLevelNameChanged LevelChangedEvent;
+
+    FName CurrentLevelFName;
+    FString CurrentLevelName;
+    bool bResolved = false;
+
+    FDelegateHandle LevelAddedHandle;
+    FDelegateHandle LevelRemovedHandle;
+};
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Core/StrokeGameTypes.h"
+
+class UStrokeGrid;
+class AGridMazeManager;
+
+enum class EPuzzleReplaySource : uint8
+{
+    StrokeGrid,
+    GridMaze
+};
+
+enum class EPuzzleReplayEvent : uint8
+{
+    // Stroke moves, in FStrokePuzzleSolver direction order
+    MoveUp,
+    MoveDown,
+    MoveLeft,
+    MoveRight,
+    Undo,
+    Redo,
+    Reset,
+    // Maze tile step; Cell holds the grid position
+    Step
+};
+
+struct FPuzzleReplayEvent
+{
+    uint32 TimeMs = 0;
+    EPuzzleReplayEvent Type = EPuzzleReplayEvent::Reset;
+    FIntPoint Cell = FIntPoint::ZeroValue;
+};
+
+struct FPuzzleReplayHeader
+{
+    EPuzzleReplaySource Source = EPuzzleReplaySource::StrokeGrid;
+
+    // Layout hash of the stage the session was recorded on; playback refuses other stages
+    uint32 StageHash = 0;
+
+    FIntPoint GridSize = FIntPoint::ZeroValue;
+    FString StageName;
+};
+
+// Writes puzzle input as a compact byte stream: a small header, then one varint per event
+// holding (milliseconds since the previous event << 3 | event code). Maze steps add the cell
+// as zigzag varints relative to the previous step, so a move is usually 2-4 bytes.
+class DISTRICT_TEST_API FPuzzleReplayRecorder
+{
+public:
+    void Begin(const FPuzzleReplayHeader& Header, double StartTime);
+
+    // Keeps the recorded data; Begin starts over
+    void Stop() { bRecording = false; }
+
+    bool IsRecording() const { return bRecording; }
+
+    void RecordMove(FIntPoint Direction, double Time);
+    void RecordEvent(EPuzzleReplayEvent Type, double Time);
+    void RecordStep(FIntPoint Cell, double Time);
+
+    const TArray<uint8>& GetData() const { return Data; }
+    int32 GetNumEvents() const { return NumEvents; }
+
+    bool SaveToFile(const FString& FilePath) const;
+
+private:
+    void WriteEventCode(EPuzzleReplayEvent Type, double Time);
+
+    TArray<uint8> Data;
+    double StartTime = 0.0;
+    uint32 LastTimeMs = 0;
+    FIntPoint LastStep = FIntPoint::ZeroValue;
+    int32 NumEvents = 0;
+    bool bRecording = false;
+};
+
+struct DISTRICT_TEST_API FPuzzleReplay
+{
+    FPuzzleReplayHeader Header;
+    TArray<FPuzzleReplayEvent> Events;
+
+    static bool Parse(TConstArrayView<uint8> Data, FPuzzleReplay& OutReplay, FString& OutError);
+    static bool LoadFromFile(const FString& FilePath, FPuzzleReplay& OutReplay, FString& OutError);
+
+    static uint32 HashStage(const FStrokePuzzleData& Puzzle);
+    static uint32 HashStage(FIntPoint GridSize, const TArray<FIntPoint>& CorrectPath);
+
+    // Relative names go under Saved/Replays
+    static FString ResolvePath(const FString& FilePath);
+
+    static EPuzzleReplayEvent DirectionToEvent(FIntPoint Direction);
+    static FIntPoint EventToDirection(EPuzzleReplayEvent Type);
+};
+
+// Feeds a parsed replay back into the puzzle it was recorded on. The target must already be on
+// the recorded stage and freshly reset; events are then applied through the same entry points
+// the player uses (MovePlayer/UndoMove/RedoMove/ResetGame, OnCellStep), so the puzzle logic
+// runs exactly as it did live.
+class DISTRICT_TEST_API FPuzzleReplayPlayer : public TSharedFromThis<FPuzzleReplayPlayer>
+{
+public:
+    explicit FPuzzleReplayPlayer(FPuzzleReplay InReplay);
+    ~FPuzzleReplayPlayer();
+
+    // Speed <= 0 applies every event at once
+    bool Play(UStrokeGrid* Grid, float Speed, FString& OutError);
+
+    // The maze preview and resets run on the maze clock, which follows world time, so only
+    // speed 1 is accepted. Events are due by world time and applied at their recorded
+    // timestamps; see AGridMazeManager::GetClockTime.
+    bool Play(AGridMazeManager* Maze, float Speed, FString& OutError);
+
+    void Stop();
+    bool IsPlaying() const { return TickerHandle.IsValid(); }
+
+    const FPuzzleReplay& GetReplay() const { return Replay; }
+
+    // Maze clock time of the next event still to be applied, MAX_dbl once all are applied
+    double GetNextMazeEventTime() const;
+
+private:
+    void Start(float Speed);
+    bool Tick(float DeltaTime);
+    void ApplyEvent(const FPuzzleReplayEvent& Event);
+
+    FPuzzleReplay Replay;
+
+    TWeakObjectPtr<UStrokeGrid> Grid;
+    TWeakObjectPtr<AGridMazeManager> Maze;
+
+    FTSTicker::FDelegateHandle TickerHandle;
+    double PlaybackTimeMs = 0.0;
+    double MazeStartTime = 0.0;
+    float PlaybackSpeed = 1.0f;
+    int32 NextEvent = 0;
+};
@@ -4,7 +4,7 @@
 #include "Engine/DataTable.h"
 #include "StrokeGameTypes.generated.h"
 
-//  Ÿ 
+// 셀 타입 열거형
 UENUM(BlueprintType)
 enum class EStrokeCellType : uint8
 {
@@ -18,7 +18,7 @@ enum class EStrokeCellType : uint8
     Visited     UMETA(DisplayName = "Visited")
 };
 
-//   
+// 게임 상태 열거형
 UENUM(BlueprintType)
 enum class EStrokeGameState : uint8
 {
@@ -28,7 +28,16 @@ enum class EStrokeGameState : uint8
     Lost        UMETA(DisplayName = "Lost")
 };
 
-// ڷƮ  ü
+// 힌트 결과 열거형
+UENUM(BlueprintType)
+enum class EStrokeHintResult : uint8
+{
+    Move        UMETA(DisplayName = "Move"),
+    DeadEnd     UMETA(DisplayName = "Dead End"),
+    Unknown     UMETA(DisplayName = "Unknown")
+};
+
+// 텔레포트 포털 구조체
 USTRUCT(BlueprintType)
 struct DISTRICT_TEST_API FTeleportPortal
 {
@@ -57,25 +66,25 @@ struct DISTRICT_TEST_API FTeleportPortal
         PortalID = ID;
     }
 
-    //  ϼǾ Ȯ
+    // 포털이 완성되었는지 확인
     bool IsComplete() const
     {
         return PortalA.X != -1 && PortalB.X != -1;
     }
 
-    //  ִ Ȯ
+    // 포털이 비어있는지 확인
     bool IsEmpty() const
     {
         return PortalA.X == -1 && PortalB.X == -1;
     }
 
-    // Ư ġ  п ԵǴ Ȯ
+    // 특정 위치가 이 포털에 포함되는지 확인
     bool Contains(FIntPoint Position) const
     {
         return PortalA == Position || PortalB == Position;
     }
 
-    // Ա ġ ָ ⱸ ġ ȯ
+    // 입구 위치를 주면 출구 위치 반환
     FIntPoint GetDestination(FIntPoint Entry) const
     {
         if (Entry == PortalA && PortalB.X != -1)
@@ -86,11 +95,11 @@ struct DISTRICT_TEST_API FTeleportPortal
         {
             return PortalA;
         }
-        return Entry; // ڷƮ Ұ
+        return Entry; // 텔레포트 불가능
     }
 };
 
-//   ü
+// 셀 데이터 구조체
 USTRUCT(BlueprintType)
 struct DISTRICT_TEST_API FStrokeCellData
 {
@@ -119,7 +128,7 @@ struct DISTRICT_TEST_API FStrokeCellData
         GridPosition = InPosition;
     }
 
-    //  Լ
+    // 편의 함수들
     bool IsSpecialCell() const
     {
         return CellType != EStrokeCellType::Empty && CellType != EStrokeCellType::Visited;
@@ -138,7 +147,7 @@ struct DISTRICT_TEST_API FStrokeCellData
     }
 };
 
-//   ü (DataTable)
+// 퍼즐 데이터 구조체 (DataTable용)
 USTRUCT(BlueprintType)
 struct DISTRICT_TEST_API FStrokePuzzleData : public FTableRowBase
 {
@@ -175,7 +184,7 @@ struct DISTRICT_TEST_API FStrokePuzzleData : public FTableRowBase
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Difficulty",
         meta = (ClampMin = "0"))
-    float TimeLimit = 0.0f; // 0 = 
+    float TimeLimit = 0.0f; // 0 = 무제한
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gameplay")
     bool bAllowRestart = true;
@@ -205,19 +214,19 @@ struct DISTRICT_TEST_API FStrokePuzzleData : public FTableRowBase
         bShowHints = false;
     }
 
-    //  Լ
+    // 편의 함수들
     bool IsValidPuzzle() const
     {
-        // ⺻ ȿ ˻
+        // 기본 유효성 검사
         if (GridSize.X < 3 || GridSize.Y < 3) return false;
         if (!IsPositionInGrid(StartPosition)) return false;
         if (!IsPositionInGrid(GoalPosition)) return false;
         if (StartPosition == GoalPosition) return false;
 
-        // ʼ Ʈ ּ 1 ־ 
+        // 필수 포인트가 최소 1개는 있어야 함
         if (RequiredPoints.Num() == 0) return false;
 
-        //  ġ ׸  ִ Ȯ
+        // 모든 위치가 그리드 내에 있는지 확인
         for (const FIntPoint& Point : RequiredPoints)
         {
             if (!IsPositionInGrid(Point)) return false;
@@ -228,7 +237,7 @@ struct DISTRICT_TEST_API FStrokePuzzleData : public FTableRowBase
             if (!IsPositionInGrid(Wall)) return false;
         }
 
-        // ڷƮ  ȿ Ȯ
+        // 텔레포트 포털 유효성 확인
         for (const FTeleportPortal& Portal : TeleportPortals)
         {
             if (Portal.IsComplete())
@@ -283,7 +292,7 @@ struct DISTRICT_TEST_API FStrokePuzzleData : public FTableRowBase
 
     int32 GetEstimatedMoves() const
     {
-        //  :  ->  ʼ -> 
+        // 간단한 추정: 시작점 -> 모든 필수점 -> 골점
         return RequiredPoints.Num() + 2;
     }
 
@@ -304,7 +313,7 @@ struct DISTRICT_TEST_API FStrokePuzzleData : public FTableRowBase
     }
 };
 
-//    ü
+// 게임 진행 상태 구조체
 USTRUCT(BlueprintType)
 struct DISTRICT_TEST_API FStrokeGameProgress
 {
@@ -382,13 +391,13 @@ struct DISTRICT_TEST_API FStrokeGameProgress
     }
 };
 
-//   ü
+// 게임 설정 구조체
 USTRUCT(BlueprintType)
 struct DISTRICT_TEST_API FStrokeGameSettings
 {
     GENERATED_BODY()
 
-    // ð 
+    // 시각적 설정
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Visual")
     float CellSize = 50.0f;
 
@@ -407,7 +416,7 @@ struct DISTRICT_TEST_API FStrokeGameSettings
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Visual")
     bool bAnimateMovement = true;
 
-    // ÷ 
+    // 게임플레이 설정
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gameplay")
     bool bAllowDiagonalMovement = false;
 
@@ -417,7 +426,7 @@ struct DISTRICT_TEST_API FStrokeGameSettings
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gameplay")
     float MovementSpeed = 1.0f;
 
-    //  
+    // 색상 설정
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Colors")
     FLinearColor EmptyColor = FLinearColor::White;
 
@@ -487,4 +496,18 @@ struct DISTRICT_TEST_API FStrokeStageData : public FTableRowBase
         StartPosition = FIntPoint(0, 6);
         GoalPosition = FIntPoint(6, 0);
     }
+
+    // 퍼즐 데이터로 변환
+    FStrokePuzzleData ToPuzzleData() const
+    {
+        FStrokePuzzleData PuzzleData;
+        PuzzleData.PuzzleName = StageName;
+        PuzzleData.GridSize = FIntPoint(GridWidth, GridHeight);
+        PuzzleData.StartPosition = StartPosition;
+        PuzzleData.GoalPosition = GoalPosition;
+        PuzzleData.RequiredPoints = RequiredPoints;
+        PuzzleData.WallPositions = WallPositions;
+        PuzzleData.TeleportPortals = TeleportPortals;
+        return PuzzleData;
+    }
 };
\ No newline at end of file
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/StrokeGameTypes.h"
+
+// Dense per-cell lookup tables compiled from an FStrokePuzzleData.
+// Cells use the same X * Height + Y indexing as UStrokeGrid::CellWidgets.
+struct DISTRICT_TEST_API FStrokeGridLayout
+{
+    void Build(const FStrokePuzzleData& Puzzle);
+    void Reset();
+
+    int32 Num() const { return CellTypes.Num(); }
+
+    int32 ToIndex(FIntPoint Position) const
+    {
+        return IsInGrid(Position) ? Position.X * Size.Y + Position.Y : INDEX_NONE;
+    }
+
+    FIntPoint ToPosition(int32 Index) const
+    {
+        return FIntPoint(Index / Size.Y, Index % Size.Y);
+    }
+
+    bool IsInGrid(FIntPoint Position) const
+    {
+        return Position.X >= 0 && Position.X < Size.X && Position.Y >= 0 && Position.Y < Size.Y;
+    }
+
+    EStrokeCellType GetCellType(int32 Index) const
+    {
+        return CellTypes.IsValidIndex(Index) ? CellTypes[Index] : EStrokeCellType::Empty;
+    }
+
+    bool IsWall(int32 Index) const
+    {
+        return Walls.IsValidIndex(Index) && Walls[Index];
+    }
+
+    // Cell index of the paired portal exit, or INDEX_NONE
+    int32 GetPortalPartner(int32 Index) const
+    {
+        return PortalPartners.IsValidIndex(Index) ? PortalPartners[Index] : INDEX_NONE;
+    }
+
+    // ID of the first portal touching this cell (complete or not), or -1
+    int32 GetPortalID(int32 Index) const
+    {
+        return PortalIDs.IsValidIndex(Index) ? PortalIDs[Index] : -1;
+    }
+
+    // Slot in the required point bitmask, or INDEX_NONE
+    int32 GetRequiredSlot(int32 Index) const
+    {
+        return RequiredSlots.IsValidIndex(Index) ? RequiredSlots[Index] : INDEX_NONE;
+    }
+
+    int32 GetNumRequiredSlots() const { return NumRequiredSlots; }
+
+    FIntPoint Size = FIntPoint::ZeroValue;
+    int32 StartIndex = INDEX_NONE;
+    int32 GoalIndex = INDEX_NONE;
+
+private:
+    TArray<EStrokeCellType> CellTypes;
+    TBitArray<> Walls;
+    TArray<int32> PortalPartners;
+    TArray<int32> PortalIDs;
+    TArray<int32> RequiredSlots;
+    int32 NumRequiredSlots = 0;
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/StrokeGameTypes.h"
+
+class FStrokePuzzleSolver;
+
+struct FStrokeHintRequest
+{
+    FIntPoint Position = FIntPoint::ZeroValue;
+    TArray<FIntPoint> VisitedPositions;
+    TArray<FIntPoint> CollectedPoints;
+};
+
+// Answers "what is the next correct move" for a stroke puzzle in progress.
+// Searches run on the thread pool, one at a time, against a solver that keeps its
+// dead-state cache for the lifetime of the puzzle; results come back on the game thread.
+class DISTRICT_TEST_API FStrokeHintEngine : public TSharedFromThis<FStrokeHintEngine, ESPMode::ThreadSafe>
+{
+public:
+    DECLARE_DELEGATE_ThreeParams(FOnHintReady, EStrokeHintResult /*Result*/, FIntPoint /*Direction*/, const FStrokeHintRequest& /*Request*/);
+
+    FStrokeHintEngine(const FStrokePuzzleData& InPuzzle, bool bInEnforceRGBOrder);
+    ~FStrokeHintEngine();
+
+    // Replaces any request still waiting; a running search for an older request is cancelled
+    void RequestHint(FStrokeHintRequest Request, FOnHintReady OnReady);
+
+    void Cancel();
+
+    bool IsBusy() const { return bRunning || PendingRequest.IsSet(); }
+
+    bool IsEnforcingRGBOrder() const { return bEnforceRGBOrder; }
+
+private:
+    struct FSearchContext;
+
+    void LaunchPending();
+    void OnSearchFinished(const FStrokeHintRequest& Request, EStrokeHintResult Result, FIntPoint Direction);
+
+    bool bEnforceRGBOrder = false;
+
+    TSharedPtr<FSearchContext, ESPMode::ThreadSafe> Context;
+
+    TOptional<FStrokeHintRequest> PendingRequest;
+    FOnHintReady PendingCallback;
+    FOnHintReady RunningCallback;
+    bool bRunning = false;
+};
@@ -0,0 +1,162 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/StrokeGameTypes.h"
+#include "Core/StrokeGridLayout.h"
+#include <atomic>
+
+struct DISTRICT_TEST_API FStrokeSolverSettings
+{
+    bool bEnforceRGBOrder = false;
+
+    // Counting stops once this many solutions are found
+    int64 MaxSolutions = 1000;
+
+    // Search budget; the result is marked incomplete when it runs out
+    int64 MaxNodes = 20000000;
+
+    int32 MaxMemoEntries = 1 << 20;
+
+    // Solutions reached through the memo are counted but not stored;
+    // set MaxMemoEntries to 0 when every counted solution must be stored
+    int32 MaxStoredSolutions = 1;
+
+    // Checked during the search; setting it stops the search early
+    const std::atomic<bool>* CancelFlag = nullptr;
+};
+
+struct DISTRICT_TEST_API FStrokeSolveResult
+{
+    bool bSolvable = false;
+
+    // False when the node budget ran out before the search finished
+    bool bComplete = false;
+
+    // True when counting stopped at MaxSolutions
+    bool bCountCapped = false;
+
+    int64 SolutionCount = 0;
+    int64 NodesVisited = 0;
+    double SolveTimeSeconds = 0.0;
+
+    // Move directions per stored solution, in MovePlayer order
+    TArray<TArray<FIntPoint>> Solutions;
+
+    FString Error;
+};
+
+// Exhaustive solver for the one-stroke rules enforced by UStrokeGrid::MovePlayer:
+// no revisiting cells that were stepped off, walls block, portals teleport on entry,
+// required points are collected when left, and the goal only wins once all are collected.
+class DISTRICT_TEST_API FStrokePuzzleSolver
+{
+public:
+    // Enough for 30x30 grids
+    static constexpr int32 MaxCells = 1024;
+    static constexpr int32 MaxRequiredPoints = 64;
+
+    FStrokePuzzleSolver(const FStrokePuzzleData& Puzzle, const FStrokeSolverSettings& InSettings);
+
+    static FStrokeSolveResult Solve(const FStrokePuzzleData& Puzzle, const FStrokeSolverSettings& Settings = FStrokeSolverSettings());
+
+    // Solves from a game in progress, as tracked by UStrokeGrid. States proven dead are cached
+    // on this instance, so repeated calls for the same puzzle get faster.
+    FStrokeSolveResult SolveFrom(FIntPoint Position, const TArray<FIntPoint>& VisitedPositions, const TArray<FIntPoint>& CollectedPoints);
+
+private:
+    static constexpr int32 NumWords = MaxCells / 64;
+
+    // Words past UsedWords are always zero, so small grids only hash and compare the words they touch
+    struct FVisitedSet
+    {
+        uint64 Words[NumWords] = {};
+        int32 UsedWords = 0;
+
+        bool Contains(int32 Index) const { return (Words[Index >> 6] >> (Index & 63)) & 1; }
+
+        void Add(int32 Index)
+        {
+            Words[Index >> 6] |= uint64(1) << (Index & 63);
+            UsedWords = FMath::Max(UsedWords, (Index >> 6) + 1);
+        }
+
+        bool operator==(const FVisitedSet& Other) const
+        {
+            return UsedWords == Other.UsedWords && FMemory::Memcmp(Words, Other.Words, UsedWords * sizeof(uint64)) == 0;
+        }
+
+        friend uint32 GetTypeHash(const FVisitedSet& Set)
+        {
+            return FCrc::MemCrc32(Set.Words, Set.UsedWords * sizeof(uint64));
+        }
+    };
+
+    struct FStateKey
+    {
+        FVisitedSet Visited;
+        uint64 Collected = 0;
+        int32 Cell = INDEX_NONE;
+        uint8 Order = 0;
+
+        bool operator==(const FStateKey& Other) const
+        {
+            return Cell == Other.Cell && Collected == Other.Collected && Order == Other.Order && Visited == Other.Visited;
+        }
+
+        friend uint32 GetTypeHash(const FStateKey& Key)
+        {
+            uint32 Hash = GetTypeHash(Key.Visited);
+            Hash = HashCombine(Hash, GetTypeHash(Key.Collected));
+            return HashCombine(Hash, GetTypeHash(Key.Cell) ^ (uint32(Key.Order) << 24));
+        }
+    };
+
+    // One state on the depth-first search stack
+    struct FSearchFrame
+    {
+        FStateKey State;
+        int64 Count = 0;
+        int32 SavedChainStart = 0;
+        int32 NextDirection = 0;
+        bool bProgress = false;
+    };
+
+    FStrokeSolveResult Run(const FStateKey& Start);
+
+    // Returns the number of solutions below this state. Depth-first with an explicit stack,
+    // since a path can be as long as the grid has cells and hint searches run on pool threads.
+    int64 Search(const FStateKey& Start);
+
+    // Pushes a frame for State and returns true, or returns false with the count when the
+    // state is settled without searching (pruned, cached or a loop)
+    bool EnterState(const FStateKey& State, int64& OutCount);
+
+    // Pops the finished top frame and returns its count
+    int64 LeaveState();
+    bool CanStillFinish(const FStateKey& State) const;
+    bool TryMove(const FStateKey& State, int32 Direction, FStateKey& OutState) const;
+    bool IsWin(const FStateKey& State) const;
+    bool ShouldStop() const;
+
+    static const FIntPoint Directions[4];
+    static constexpr uint8 OrderBroken = 0xFF;
+    static constexpr uint8 OrderComplete = 3;
+
+    FStrokeGridLayout Layout;
+    FStrokeSolverSettings Settings;
+    FStrokeSolveResult Result;
+
+    FString SetupError;
+    bool bCanCollectAll = false;
+    uint64 AllCollected = 0;
+    TMap<FStateKey, int64> Memo;
+
+    // Teleporting onto an exit that was already stepped off does not grow the visited set,
+    // so those states are tracked on a stack to break loops
+    TArray<FStateKey> NoProgressChain;
+    int32 NoProgressChainStart = 0;
+
+    TArray<FIntPoint> MoveStack;
+    TArray<FSearchFrame> SearchStack;
+    mutable TArray<int32> ScratchQueue;
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/StrokeGameTypes.h"
+#include "StrokeStageGenerator.generated.h"
+
+class UDataTable;
+
+USTRUCT(BlueprintType)
+struct DISTRICT_TEST_API FStrokeGeneratorSettings
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generator", meta = (ClampMin = "3", ClampMax = "20"))
+    FIntPoint GridSize = FIntPoint(7, 7);
+
+    // Fraction of the cells off the solution path that start out as walls;
+    // more walls are added where needed to make the solution unique
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generator", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float WallDensity = 0.2f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generator", meta = (ClampMin = "0", ClampMax = "4"))
+    int32 PortalCount = 0;
+
+    // Controls how much of the grid the solution path covers
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generator", meta = (ClampMin = "1", ClampMax = "10"))
+    int32 Difficulty = 5;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generator")
+    bool bEnforceRGBOrder = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generator", meta = (ClampMin = "1"))
+    int32 StageCount = 1;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generator")
+    int32 Seed = 0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generator", meta = (ClampMin = "1"))
+    int32 MaxAttemptsPerStage = 200;
+};
+
+// Builds stroke stages whose only solution is a random walk laid down first:
+// required points and the goal go on the walk, decoy portals and walls go off it,
+// and extra walls are added on whatever cells an alternative solution uses.
+class DISTRICT_TEST_API FStrokeStageGenerator
+{
+public:
+    // Generates Settings.StageCount stages in parallel. Stages that ran out of attempts are left out.
+    static TArray<FStrokeStageData> Generate(const FStrokeGeneratorSettings& Settings);
+
+    static bool GenerateStage(const FStrokeGeneratorSettings& Settings, FRandomStream& Random, FStrokeStageData& OutStage);
+
+    // Adds the stages as Stage_NN rows starting at FirstStageNumber, replacing existing rows
+    static void WriteToDataTable(UDataTable* Table, const TArray<FStrokeStageData>& Stages, int32 FirstStageNumber);
+
+private:
+    static bool TryGenerateStage(const FStrokeGeneratorSettings& Settings, FRandomStream& Random, FStrokeStageData& OutStage);
+    static bool BuildRandomWalk(FIntPoint GridSize, int32 TargetLength, FRandomStream& Random, TArray<FIntPoint>& OutPath);
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/StrokeGameTypes.h"
+#include "HAL/CriticalSection.h"
+
+class UDataTable;
+class IFileHandle;
+
+// Read-only pack of FStrokeStageData records cooked from a Stage_NN data table.
+// Opening reads only the index; records are read from disk when a stage is asked for,
+// and the next stage can be decoded on the thread pool ahead of time.
+//
+// Layout (little endian):
+//   uint32 Magic, uint16 Version, uint16 Reserved, int32 Count
+//   Count x { int32 StageNumber, uint32 Offset, uint32 Size }, sorted by StageNumber
+//   records: uint16 NameBytes, uint8 Width, uint8 Height, int8 Start X/Y, int8 Goal X/Y,
+//            uint16 NumRequired, uint16 NumWalls, uint8 NumPortals, uint8 Reserved,
+//            UTF-8 name, int8 X/Y per required point and wall, { uint8 ID, int8 A X/Y, int8 B X/Y } per portal
+class DISTRICT_TEST_API FStrokeStagePack : public TSharedFromThis<FStrokeStagePack, ESPMode::ThreadSafe>
+{
+public:
+    ~FStrokeStagePack();
+
+    // Returns null when the file is missing or not a stage pack
+    static TSharedPtr<FStrokeStagePack, ESPMode::ThreadSafe> Open(const FString& FilePath);
+
+    // Cooks every Stage_NN row of the table; other rows are skipped with a warning
+    static bool Cook(const UDataTable* Table, TArray<uint8>& OutData, FString& OutError);
+
+    // Relative paths are under the project Content directory
+    static FString ResolvePath(const FString& FilePath);
+
+    int32 Num() const { return Index.Num(); }
+    bool Contains(int32 StageNumber) const { return FindEntry(StageNumber) != nullptr; }
+
+    bool LoadStage(int32 StageNumber, FStrokeStageData& OutStage);
+
+    // Decodes the stage in the background so a later LoadStage is a cache hit
+    void Prefetch(int32 StageNumber);
+
+private:
+    struct FIndexEntry
+    {
+        int32 StageNumber = 0;
+        uint32 Offset = 0;
+        uint32 Size = 0;
+    };
+
+    const FIndexEntry* FindEntry(int32 StageNumber) const;
+    bool ReadStage(const FIndexEntry& Entry, FStrokeStageData& OutStage);
+    void AddToCache(int32 StageNumber, const FStrokeStageData& Stage);
+
+    static void EncodeStage(const FStrokeStageData& Stage, TArray<uint8>& OutData);
+    static bool DecodeStage(TConstArrayView<uint8> Data, FStrokeStageData& OutStage);
+
+    static constexpr int32 MaxCachedStages = 4;
+
+    TArray<FIndexEntry> Index;
+
+    FCriticalSection FileLock;
+    TUniquePtr<IFileHandle> File;
+
+    FCriticalSection CacheLock;
+    TArray<TPair<int32, FStrokeStageData>> Cache;
+    TSet<int32> PendingPrefetch;
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "StrokeStageValidatorCommandlet.generated.h"
+
+// Solves every row of the stroke stage tables in parallel and reports
+// solvability, solution count and solve time.
+//
+// UnrealEditor-Cmd District_test.uproject -run=StrokeStageValidator
+//     [-Table=/Game/Path/DT_A,/Game/Path/DT_B] [-EnforceRGBOrder] [-MaxSolutions=N] [-MaxNodes=N]
+//
+// -Table takes a comma-separated list of tables.
+// Returns non-zero when any row is unsolvable or could not be decided.
+UCLASS()
+class DISTRICT_TEST_API UStrokeStageValidatorCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UStrokeStageValidatorCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -8,19 +8,18 @@
 #include "Components/StaticMeshComponent.h"
 #include "Sound/SoundBase.h"
 #include "Engine/TimerHandle.h"
+#include "Gameplay/GridTile.h"
+#include "Gameplay/MazePathGenerator.h"
+#include "Gameplay/MazeSimulation.h"
+#include "Gameplay/MazePreviewSequencer.h"
+#include "Core/PuzzleReplay.h"
 #include "GridMazeManager.generated.h"
 
 class AGridTile;
 class AMazeDisplay;
-
-UENUM(BlueprintType)
-enum class EPuzzleState : uint8
-{
-    Ready       UMETA(DisplayName = "Ready"),
-    Playing     UMETA(DisplayName = "Playing"),
-    Success     UMETA(DisplayName = "Success"),
-    Failed      UMETA(DisplayName = "Failed")
-};
+class UInstancedStaticMeshComponent;
+class UTileLightPoolComponent;
+class UMaterialInterface;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPuzzleStateChanged, EPuzzleState, NewState);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTimerUpdate, float, TimeRemaining);
@@ -39,6 +38,8 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void PostRegisterAllComponents() override;
+    virtual void PostUnregisterAllComponents() override;
     virtual void Tick(float DeltaTime) override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void Destroyed() override;
@@ -49,7 +50,7 @@ protected:
 #endif
 
 public:
-    // ============ ׸  ============
+    // ============ 그리드 설정 ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid Settings|Size")
     int32 GridRows = 4;
@@ -69,11 +70,46 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid Settings|Tile")
     float TileSpacing = 50.0f;
 
-    // ============   ============
+    // 그리드를 다시 만들 때 타일을 파괴하지 않고 숨겨 두었다가 재사용
+    // 게임 중 재생성할 때 타일을 숨겨 두고 재사용 (에디터에서는 항상 파괴 후 새로 생성)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid Settings|Tile Pool")
+    bool bPoolTiles = true;
+
+    // 그리드를 다시 만든 뒤 풀에 남겨 둘 여분 타일 수 (넘는 타일은 파괴)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid Settings|Tile Pool", meta = (ClampMin = "0", EditCondition = "bPoolTiles"))
+    int32 MaxPooledTiles = 256;
+
+    // 타일 액터 대신 인스턴스드 메시 하나로 그리드를 그림
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Grid Settings|Batched")
+    bool bUseBatchedTiles = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Grid Settings|Batched", meta = (EditCondition = "bUseBatchedTiles"))
+    UStaticMesh* BatchedTileMesh;
+
+    // PerInstanceCustomData 0~2: 상태 색상, 3: 깜박임 여부
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Grid Settings|Batched", meta = (EditCondition = "bUseBatchedTiles"))
+    UMaterialInterface* BatchedTileMaterial;
+
+    // 플레이어가 타일 위에 있다고 판정하는 높이 범위
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid Settings|Batched", meta = (EditCondition = "bUseBatchedTiles"))
+    float BatchedStepHeight = 200.0f;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Grid Settings|Batched")
+    UInstancedStaticMeshComponent* TileInstances;
+
+    // 타일 조명 풀 (활성화 시 타일 개별 조명 대신 사용)
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Grid Settings|Light Pool")
+    UTileLightPoolComponent* LightPool;
+
+    // ============ 퍼즐 설정 ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle Settings|Time")
     float PuzzleTimeLimit = 60.0f;
 
+    // 표시 값이 바뀔 때만 타이머로 시계 갱신, 배치 모드 발판 감지가 필요 없으면 틱을 끔
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle Settings|Time")
+    bool bTimerDrivenClock = true;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle Settings|Preview")
     bool bEnablePreview = true;
 
@@ -81,10 +117,22 @@ public:
     float PreviewDuration = 10.0f;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle Settings|Preview")
-    float TileLightDelay = 0.5f;  //  Ÿ  
+    float TileLightDelay = 0.5f;  // 각 타일이 켜지는 간격
+
+    // 미리보기 재생 배속 (재생 중 변경 가능)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle Settings|Preview", meta = (ClampMin = "0.0"))
+    float PreviewSpeed = 1.0f;
+
+    // 끝나면 처음부터 반복 (SkipPreview로 종료)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle Settings|Preview")
+    bool bLoopPreview = false;
+
+    // 한 프레임에 바꾸는 타일 수 상한
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle Settings|Preview", meta = (ClampMin = "1"))
+    int32 MaxPreviewTilesPerFrame = 16;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle Settings|Correct Display")
-    float CorrectDisplayDuration = 1.0f;  // ʷϻ ǥ ð
+    float CorrectDisplayDuration = 1.0f;  // 초록색 표시 시간
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle Settings|Fail")
     bool bAutoResetOnFail = false;
@@ -98,7 +146,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle Settings|Progress")
     bool bKeepProgressOnFail = true;
 
-    // ============  ġ  ============
+    // ============ 시작 위치 설정 ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Starting Floor")
     bool bUseStartingFloor = true;
@@ -115,7 +163,7 @@ public:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Starting Floor")
     UStaticMeshComponent* StartingFloorMesh;
 
-    // ============   ============
+    // ============ 경로 설정 ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Path Settings", meta = (TitleProperty = "ToString"))
     TArray<FIntPoint> CorrectPath;
@@ -126,7 +174,22 @@ public:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Path Settings")
     FIntPoint GoalPosition = FIntPoint(3, 3);
 
-    // ============   (ŸϿ ) ============
+    // 켜면 BeginPlay에서 CorrectPath를 무작위로 생성
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Path Settings|Generator")
+    bool bGenerateRandomPath = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Path Settings|Generator", meta = (EditCondition = "bGenerateRandomPath"))
+    FMazePathSettings PathGenerator;
+
+    // CompleteReset 할 때마다 새 경로 생성
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Path Settings|Generator", meta = (EditCondition = "bGenerateRandomPath"))
+    bool bRegeneratePathOnReset = true;
+
+    // 생성 횟수 (Seed가 고정이면 Seed + 생성 횟수로 같은 경로 재현)
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Path Settings|Generator")
+    int32 PathGeneration = 0;
+
+    // ============ 색상 설정 (타일에 적용) ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Color Settings")
     FLinearColor InactiveColor = FLinearColor(0.1f, 0.1f, 0.1f, 1.0f);
@@ -146,7 +209,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Color Settings")
     FLinearColor WrongColor = FLinearColor(1.0f, 0.2f, 0.2f, 1.0f);
 
-    // ============   ============
+    // ============ 사운드 설정 ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sound Settings")
     USoundBase* CorrectStepSound;
@@ -163,7 +226,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sound Settings")
     float SoundVolume = 1.0f;
 
-    // ============ ÷  ============
+    // ============ 디스플레이 연결 ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Display Connection")
     AMazeDisplay* ConnectedDisplay;
@@ -171,7 +234,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Display Connection")
     bool bAutoFindDisplay = true;
 
-    // ============   ============
+    // ============ 에디터 프리뷰 ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Editor Preview")
     bool bShowPreviewInEditor = true;
@@ -179,7 +242,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Editor Preview")
     bool bShowPathInPreview = true;
 
-    // ============   ============
+    // ============ 현재 상태 ============
 
     UPROPERTY(BlueprintReadOnly, Category = "Current State")
     EPuzzleState CurrentState = EPuzzleState::Ready;
@@ -196,14 +259,19 @@ public:
     UPROPERTY(BlueprintReadOnly, Category = "Current State")
     bool bIsShowingPreview = false;
 
-    UPROPERTY(BlueprintReadOnly, Category = "Progress Tracking")
+    // 마지막으로 밟은 칸 (배치 모드에서는 BP 이벤트의 Tile 인자가 nullptr)
+    UPROPERTY(BlueprintReadOnly, Category = "Current State")
+    FIntPoint LastSteppedCell = FIntPoint(-1, -1);
+
+    // 값은 시뮬레이션의 진행 기록에서 읽음 (BP 변수 노드 호환용)
+    UPROPERTY(BlueprintReadOnly, BlueprintGetter = GetCompletedSteps, Category = "Progress Tracking")
     TArray<FIntPoint> CompletedSteps;
 
-    UPROPERTY(BlueprintReadOnly, Category = "Progress Tracking")
+    UPROPERTY(BlueprintReadOnly, BlueprintGetter = GetFailedSteps, Category = "Progress Tracking")
     TArray<FIntPoint> FailedSteps;
 
 public:
-    // ============ ̺Ʈ Ʈ ============
+    // ============ 이벤트 델리게이트 ============
 
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FOnPuzzleStateChanged OnPuzzleStateChanged;
@@ -223,195 +291,265 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FOnPuzzleFailed OnPuzzleFailed_Event;
 
-    // ============   Լ ============
+    // ============ 퍼즐 제어 함수 ============
 
-    //  
+    // 퍼즐 시작
     UFUNCTION(BlueprintCallable, Category = "Puzzle Control")
     void StartPuzzle();
 
-    // īƮٿ Բ 
+    // 카운트다운과 함께 시작
     UFUNCTION(BlueprintCallable, Category = "Puzzle Control")
     void StartPuzzleWithCountdown();
 
-    //  
+    // 퍼즐 리셋
     UFUNCTION(BlueprintCallable, Category = "Puzzle Control")
     void ResetPuzzle();
 
-    //   (൵ )
+    // 완전 리셋 (진행도 포함)
     UFUNCTION(BlueprintCallable, Category = "Puzzle Control")
     void CompleteReset();
 
-    //   ó
+    // 퍼즐 성공 처리
     UFUNCTION(BlueprintCallable, Category = "Puzzle Control")
     void CompletePuzzle();
 
-    //   ó
+    // 퍼즐 실패 처리
     UFUNCTION(BlueprintCallable, Category = "Puzzle Control")
     void FailPuzzle();
 
-    //  Ͻ
+    // 퍼즐 일시정지
     UFUNCTION(BlueprintCallable, Category = "Puzzle Control")
     void PausePuzzle();
 
-    //  簳
+    // 퍼즐 재개
     UFUNCTION(BlueprintCallable, Category = "Puzzle Control")
     void ResumePuzzle();
 
-    // ============ Ÿ  ============
+    // ============ 타일 관리 ============
 
-    // Ÿ  ̺Ʈ ó
+    // 타일 스텝 이벤트 처리
     UFUNCTION(BlueprintCallable, Category = "Tile Management")
     void OnTileStep(AGridTile* SteppedTile, AActor* Player);
 
-    // Ư ġ Ÿ 
+    // 그리드 좌표로 스텝 처리 (타일/배치 모드 공용)
+    UFUNCTION(BlueprintCallable, Category = "Tile Management")
+    void OnCellStep(FIntPoint Cell, AActor* Player);
+
+    // 특정 위치의 타일 가져오기 (배치 모드에서는 nullptr)
     UFUNCTION(BlueprintCallable, Category = "Tile Management")
     AGridTile* GetTileAt(int32 X, int32 Y);
 
-    // ׸ 
+    // 특정 위치의 타일 상태 변경 (타일/배치 모드 공용)
+    UFUNCTION(BlueprintCallable, Category = "Tile Management")
+    void SetTileStateAt(int32 X, int32 Y, ETileState NewState);
+
+    // 특정 위치의 타일 상태 가져오기
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Tile Management")
+    ETileState GetTileStateAt(int32 X, int32 Y) const;
+
+    // 칸 중심의 월드 위치
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Tile Management")
+    FVector GetTileWorldLocation(int32 X, int32 Y) const;
+
+    // 상태별 색상 가져오기
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Tile Management")
+    FLinearColor GetStateColor(ETileState State) const;
+
+    // 월드 위치가 올라선 칸 찾기
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Tile Management")
+    bool GetCellAtLocation(const FVector& WorldLocation, FIntPoint& OutCell) const;
+
+    // 그리드 생성
     UFUNCTION(BlueprintCallable, Category = "Tile Management")
     void CreateGrid();
 
-    // ׸ 
+    // 그리드 제거
     UFUNCTION(BlueprintCallable, Category = "Tile Management")
     void ClearGrid();
 
-    //  Ÿ Ȱȭ
+    // 모든 타일 비활성화
     UFUNCTION(BlueprintCallable, Category = "Tile Management")
     void SetAllTilesInactive();
 
-    //  Ÿ غ ·
+    // 모든 타일 준비 상태로
     UFUNCTION(BlueprintCallable, Category = "Tile Management")
     void SetAllTilesReady();
 
-    // ============ ̸  ============
+    // ============ 미리보기 제어 ============
 
-    //  ̸ 
+    // 경로 미리보기 시작
     UFUNCTION(BlueprintCallable, Category = "Preview")
     void ShowPathPreviewSequence();
 
-    // ̸ 
+    // 미리보기 중지
     UFUNCTION(BlueprintCallable, Category = "Preview")
     void StopPreview();
 
-    // ============  ġ  ============
+    // 남은 경로를 모두 표시하고 미리보기 종료
+    UFUNCTION(BlueprintCallable, Category = "Preview")
+    void SkipPreview();
+
+    // ============ 시작 위치 제어 ============
 
-    //  ٴ 
+    // 시작 바닥 생성
     UFUNCTION(BlueprintCallable, Category = "Starting Floor")
     void CreateStartingFloor();
 
-    //  ٴ  
+    // 시작 바닥 색상 변경
     UFUNCTION(BlueprintCallable, Category = "Starting Floor")
     void SetStartingFloorColor(FLinearColor NewColor);
 
-    //  ġ 
+    // 시작 위치 가져오기
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Starting Floor")
     FVector GetStartingFloorLocation() const;
 
-    // ÷̾  ġ ̵
+    // 플레이어를 시작 위치로 이동
     UFUNCTION(BlueprintCallable, Category = "Starting Floor")
     void RespawnPlayerToStart(AActor* Player);
 
-    // ============ ൵  ============
+    // ============ 진행도 추적 ============
 
-    // Ϸ  ǥ
+    // 완료된 스텝 표시
     UFUNCTION(BlueprintCallable, Category = "Progress Tracking")
     void MarkStepAsCompleted(const FIntPoint& Position);
 
-    //   ǥ
+    // 실패한 스텝 표시
     UFUNCTION(BlueprintCallable, Category = "Progress Tracking")
     void MarkStepAsFailed(const FIntPoint& Position);
 
-    //  Ϸ  Ȯ
+    // 스텝 완료 여부 확인
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Progress Tracking")
     bool IsStepCompleted(const FIntPoint& Position) const;
 
-    //    Ȯ
+    // 스텝 실패 여부 확인
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Progress Tracking")
     bool IsStepFailed(const FIntPoint& Position) const;
 
-    // ൵  ʱȭ
+    // 완료된 스텝 목록 (밟은 순서)
+    UFUNCTION(BlueprintGetter, Category = "Progress Tracking")
+    TArray<FIntPoint> GetCompletedSteps() const;
+
+    // 실패한 스텝 목록 (밟은 순서)
+    UFUNCTION(BlueprintGetter, Category = "Progress Tracking")
+    TArray<FIntPoint> GetFailedSteps() const;
+
+    // 진행도 기록 초기화
     UFUNCTION(BlueprintCallable, Category = "Progress Tracking")
     void ClearProgressHistory();
 
-    // ൵  
+    // 진행도 색상 복원
     UFUNCTION(BlueprintCallable, Category = "Progress Tracking")
     void RestoreProgressColors();
 
-    // ============   ============
+    // ============ 경로 검증 ============
 
-    //   
+    // 정답 경로 검증
     UFUNCTION(BlueprintCallable, Category = "Path Validation")
     bool ValidateCorrectPath();
 
-    // ============   ============
+    // 현재 그리드 크기로 정답 경로 생성 (PathGenerator 설정 사용)
+    UFUNCTION(BlueprintCallable, CallInEditor, Category = "Path Validation")
+    void GenerateRandomPath();
+
+    // ============ 설정 변경 ============
 
-    // ׸ ũ 
+    // 그리드 크기 설정
     UFUNCTION(BlueprintCallable, Category = "Settings")
     void SetGridSize(int32 NewRows, int32 NewColumns);
 
-    //  ð 
+    // 제한 시간 설정
     UFUNCTION(BlueprintCallable, Category = "Settings")
     void SetTimeLimit(float NewTimeLimit);
 
-    //   
+    // 정답 경로 설정
     UFUNCTION(BlueprintCallable, Category = "Settings")
     void SetCorrectPath(const TArray<FIntPoint>& NewPath);
 
-    //     
+    // 실패 후 리셋 지연 설정
     UFUNCTION(BlueprintCallable, Category = "Settings")
     void SetFailResetDelay(float NewDelay);
 
-    // Ÿ β 
+    // 타일 두께 설정
     UFUNCTION(BlueprintCallable, Category = "Settings")
     void SetTileThickness(float NewThickness);
 
-    //  ϰ 
+    // 색상 일괄 설정
     UFUNCTION(BlueprintCallable, Category = "Settings")
     void SetPuzzleColors(FLinearColor Inactive, FLinearColor Ready, FLinearColor Correct, FLinearColor Wrong);
 
-    // ============  ȸ ============
+    // ============ 정보 조회 ============
 
-    //   
+    // 현재 상태 가져오기
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Information")
     EPuzzleState GetCurrentState() const { return CurrentState; }
 
-    //  ð 
+    // 남은 시간 가져오기
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Information")
     float GetTimeRemaining() const { return TimeRemaining; }
 
-    //    
+    // 현재 진행 스텝 가져오기
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Information")
     int32 GetCurrentPathIndex() const { return CurrentPathIndex; }
 
-    //    Ȯ
+    // 퍼즐 진행 중인지 확인
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Information")
     bool IsGameActive() const { return CurrentState == EPuzzleState::Playing; }
 
-    // ൵   (0.0 ~ 1.0)
+    // 진행도 비율 가져오기 (0.0 ~ 1.0)
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Information")
     float GetProgress() const;
 
-    // ൵ ؽƮ  "(3/10)" 
+    // 진행도 텍스트 가져오기 "(3/10)" 형식
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Information")
     FString GetProgressText() const;
 
-    //   
+    // 경로 길이 가져오기
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Information")
     int32 GetPathLength() const { return CorrectPath.Num(); }
 
-    // Ư ε   
+    // 특정 인덱스의 경로 스텝 가져오기
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Information")
     FIntPoint GetPathStepAt(int32 Index) const;
 
-    //  Ϸ 
+    // 퍼즐 완료 여부
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Information")
     bool IsPuzzleCompleted() const { return CurrentState == EPuzzleState::Success; }
 
-    //   
+    // 퍼즐 실패 여부
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Information")
     bool IsPuzzleFailed() const { return CurrentState == EPuzzleState::Failed; }
 
-    // ============   ============
+    // 액터 없이 돌아가는 퍼즐 규칙 (봇/커맨드렛에서 직접 진행 가능)
+    const FMazeSimulation& GetSimulation() const { return Simulation; }
+
+    // ============ 리플레이 ============
+
+    // 퍼즐을 완전 리셋하고 발판 입력 기록 시작
+    UFUNCTION(BlueprintCallable, Category = "Replay")
+    void StartReplayRecording();
+
+    // 기록 중지 (기록한 데이터는 유지)
+    UFUNCTION(BlueprintCallable, Category = "Replay")
+    void StopReplayRecording();
+
+    // 기록 저장 (상대 경로는 Saved/Replays 아래)
+    UFUNCTION(BlueprintCallable, Category = "Replay")
+    bool SaveReplay(const FString& FilePath) const;
+
+    // 같은 정답 경로에서 기록된 세션 재생 (퍼즐 시계가 월드 시간이라 1배속만 가능)
+    UFUNCTION(BlueprintCallable, Category = "Replay")
+    bool PlayReplay(const FString& FilePath, float Speed = 1.0f);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Replay")
+    bool IsReplaying() const { return ReplayPlayer.IsValid() && ReplayPlayer->IsPlaying(); }
+
+    // 퍼즐 시계 (월드 시간, 리플레이 중에는 아직 적용하지 않은 입력 시각을 넘지 않음)
+    double GetClockTime() const;
+
+    // 리플레이 입력 적용 (재생 중 실제 발판 입력은 무시됨)
+    void ApplyReplayStep(FIntPoint Cell);
+
+    // ============ 에디터 도구 ============
 
     UFUNCTION(BlueprintCallable, CallInEditor, Category = "Editor Tools")
     void EditorCreateGrid();
@@ -419,7 +557,7 @@ public:
     UFUNCTION(BlueprintCallable, CallInEditor, Category = "Editor Tools")
     void EditorClearGrid();
 
-    // ============ BP ̺Ʈ ============
+    // ============ BP 이벤트들 ============
 
     UFUNCTION(BlueprintImplementableEvent, Category = "Blueprint Events")
     void OnPuzzleStarted();
@@ -445,7 +583,7 @@ public:
     UFUNCTION(BlueprintImplementableEvent, Category = "Blueprint Events")
     void OnPreviewFinished();
 
-    // ============ BP Ŀ͸  Լ ============
+    // ============ BP 커스터마이즈 가능 함수들 ============
 
     UFUNCTION(BlueprintNativeEvent, Category = "Custom Logic")
     bool ShouldStartPuzzle(AGridTile* FirstTile);
@@ -464,26 +602,60 @@ public:
     virtual void OnPlayerRespawned_Implementation(AActor* Player) {}
 
 private:
-    void UpdateTimer(float DeltaTime);
-    void SetPuzzleState(EPuzzleState NewState);
+    void SyncSimulationSettings();
+    void SetPreviewActive(bool bActive);
+    void ProcessSimulationEvents(AGridTile* SteppedTile = nullptr);
+    void AdvanceSimulationClock();
+    void CatchUpToClock();
+    void ScheduleClockUpdate();
+    void OnClockTimer();
+    void UpdateTickEnabled();
+    bool NeedsStepDetection() const;
     void ConnectToDisplay();
     void CreateTilesInternal();
     void ClearGridTiles();
     void UpdateTilePositions();
-    void ShowNextPreviewTile(int32 Index);
+    void UpdatePreviewSequence();
+    void ApplyPreviewChanges(const TArray<FMazePreviewChange>& Changes);
+    void FinishPreview();
     void UpdateTileThickness();
     FVector CalculateTilePosition(int32 X, int32 Y);
-    bool IsValidPosition(int32 X, int32 Y);
-    bool IsCorrectNextStep(int32 X, int32 Y);
+    FVector CalculateTileLocalPosition(int32 X, int32 Y) const;
+    bool IsValidPosition(int32 X, int32 Y) const;
     void PlaySound(USoundBase* Sound);
     void ApplyTileColors();
     void DestroyAllTiles();
+    void ReleaseTilesToPool();
+    void TrimTilePool(int32 MaxTiles);
+    void RetireTile(AGridTile* Tile);
+    AGridTile* AcquireTile(const FVector& Location);
     void ResetToStartPosition();
+    void HandleStep(const FIntPoint& Cell, AGridTile* SteppedTile, AActor* Player);
+
+    void CreateBatchedTiles();
+    void RefreshBatchedInstanceTransforms();
+    void UpdateBatchedInstance(int32 Index, bool bMarkRenderStateDirty = true);
+
+    // 타일/인스턴스 생성 순서(Y 바깥, X 안쪽)와 같은 인덱스
+    int32 CellToInstanceIndex(int32 X, int32 Y) const { return Y * GridRows + X; }
+    FTransform CalculateBatchedInstanceTransform(int32 X, int32 Y) const;
+    void UpdateBatchedStepDetection();
+
+    FPuzzleReplayRecorder ReplayRecorder;
+    TSharedPtr<FPuzzleReplayPlayer> ReplayPlayer;
+
+    TArray<ETileState> BatchedTileStates;
+    FIntPoint OccupiedCell = FIntPoint(-1, -1);
 
-    FTimerHandle WrongTileTimer;
+    // 숨겨진 채 대기 중인 타일 (GridTiles에는 없음)
+    UPROPERTY(Transient)
+    TArray<AGridTile*> TilePool;
 
-    bool bGamePaused = false;
-    FTimerHandle ResetTimer;
-    FTimerHandle PreviewTimerHandle;
+    // 퍼즐 규칙 (경로 진행, 오답/실패 리셋, 제한 시간)
+    FMazeSimulation Simulation;
+    FMazePreviewSequencer PreviewSequencer;
+    double PreviewClockTime = 0.0;
+    bool bApplyingReplayStep = false;
     FTimerHandle CorrectDisplayTimer;
+    FTimerHandle ClockTimerHandle;
 };
\ No newline at end of file
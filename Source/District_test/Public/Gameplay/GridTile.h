@@ -12,12 +12,12 @@
 UENUM(BlueprintType)
 enum class ETileState : uint8
 {
-    Inactive    UMETA(DisplayName = "Inactive"),      // Ȱȭ ()
-    Preview     UMETA(DisplayName = "Preview"),       // ̸ (Ķ)
-    Ready       UMETA(DisplayName = "Ready"),         //   (Ȳ)
-    FirstStep   UMETA(DisplayName = "FirstStep"),     // ù  ǥ (Ķ )
-    Correct     UMETA(DisplayName = "Correct"),       //  (ʷϻ)
-    Wrong       UMETA(DisplayName = "Wrong")          //  ()
+    Inactive    UMETA(DisplayName = "Inactive"),      // 비활성화 (꺼짐)
+    Preview     UMETA(DisplayName = "Preview"),       // 미리보기 (파란색)
+    Ready       UMETA(DisplayName = "Ready"),         // 대기 상태 (주황색)
+    FirstStep   UMETA(DisplayName = "FirstStep"),     // 첫 스텝 표시 (파란색 깜박임)
+    Correct     UMETA(DisplayName = "Correct"),       // 정답 (초록색)
+    Wrong       UMETA(DisplayName = "Wrong")          // 오답 (빨간색)
 };
 
 class AGridTile;
@@ -35,7 +35,9 @@ public:
 
 protected:
     virtual void BeginPlay() override;
-    virtual void Tick(float DeltaTime) override;
+    virtual void PostRegisterAllComponents() override;
+    virtual void PostUnregisterAllComponents() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
     USceneComponent* RootSceneComponent;
@@ -53,30 +55,30 @@ protected:
     USphereComponent* InteractionSphere;
 
 public:
-    // ============ BP    ============
+    // ============ BP에서 설정 가능한 색상들 ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tile Colors|Inactive")
-    FLinearColor InactiveColor = FLinearColor(0.1f, 0.1f, 0.1f, 1.0f);  // ȸ
+    FLinearColor InactiveColor = FLinearColor(0.1f, 0.1f, 0.1f, 1.0f);  // 회색
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tile Colors|Preview")
-    FLinearColor PreviewColor = FLinearColor(0.2f, 0.5f, 1.0f, 1.0f);  // Ķ
+    FLinearColor PreviewColor = FLinearColor(0.2f, 0.5f, 1.0f, 1.0f);  // 파란색
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tile Colors|Ready")
-    FLinearColor ReadyColor = FLinearColor(1.0f, 0.6f, 0.2f, 1.0f);  // Ȳ
+    FLinearColor ReadyColor = FLinearColor(1.0f, 0.6f, 0.2f, 1.0f);  // 주황색
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tile Colors|FirstStep")
-    FLinearColor FirstStepColor = FLinearColor(0.3f, 0.7f, 1.0f, 1.0f);  //  Ķ
+    FLinearColor FirstStepColor = FLinearColor(0.3f, 0.7f, 1.0f, 1.0f);  // 밝은 파란색
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tile Colors|Correct")
-    FLinearColor CorrectColor = FLinearColor(0.2f, 1.0f, 0.2f, 1.0f);  // ʷϻ
+    FLinearColor CorrectColor = FLinearColor(0.2f, 1.0f, 0.2f, 1.0f);  // 초록색
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tile Colors|Wrong")
-    FLinearColor WrongColor = FLinearColor(1.0f, 0.2f, 0.2f, 1.0f);  // 
+    FLinearColor WrongColor = FLinearColor(1.0f, 0.2f, 0.2f, 1.0f);  // 빨간색
 
-    // ============    ============
+    // ============ 빛 세기 설정 ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Light Settings")
-    float InactiveLightIntensity = 0.0f;  //  
+    float InactiveLightIntensity = 0.0f;  // 꺼진 상태
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Light Settings")
     float PreviewLightIntensity = 2000.0f;
@@ -99,7 +101,17 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Light Settings")
     float LightHeight = 100.0f;
 
-    // ============ ִϸ̼  ============
+    // 조명 풀 사용 시 개별 조명 대신 켜지는 발광 머티리얼 파라미터
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Light Settings|Pool")
+    FName EmissiveParameterName = TEXT("EmissiveColor");
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Light Settings|Pool")
+    float EmissiveStrength = 5.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Light Settings|Pool")
+    bool bUsePooledLight = false;
+
+    // ============ 애니메이션 설정 ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Animation Settings")
     bool bEnableBlinking = true;
@@ -108,12 +120,12 @@ public:
     float BlinkSpeed = 3.0f;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Animation Settings")
-    bool bBlinkOnFirstStep = true;  // ù   
+    bool bBlinkOnFirstStep = true;  // 첫 스텝일 때 깜박임
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Animation Settings")
-    bool bBlinkOnWrong = true;  //   
+    bool bBlinkOnWrong = true;  // 오답일 때 깜박임
 
-    // ============   ============
+    // ============ 사운드 설정 ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sound Settings")
     bool bPlayInteractionSound = true;
@@ -130,7 +142,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sound Settings")
     float SoundVolume = 1.0f;
 
-    // ============   ============
+    // ============ 현재 상태 ============
 
     UPROPERTY(BlueprintReadOnly, Category = "Current State")
     ETileState CurrentState = ETileState::Inactive;
@@ -151,7 +163,7 @@ public:
     bool bCanBeInteracted = true;
 
 public:
-    // ============ ̺Ʈ Ʈ ============
+    // ============ 이벤트 델리게이트 ============
 
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FOnTileSteppedDelegate OnTileStepped;
@@ -162,67 +174,71 @@ public:
     UPROPERTY(BlueprintReadOnly, Category = "Manager")
     class AGridMazeManager* OwnerManager;
 
-    // ============ BP ȣ  ֿ Լ ============
+    // ============ BP에서 호출 가능한 주요 함수들 ============
 
-    // Ÿ  
+    // 타일 상태 변경
     UFUNCTION(BlueprintCallable, Category = "Tile Control")
     void SetTileState(ETileState NewState);
 
-    //   
+    // 현재 상태 가져오기
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Tile Information")
     ETileState GetTileState() const { return CurrentState; }
 
-    // ׸ ġ 
+    // 그리드 위치 설정
     UFUNCTION(BlueprintCallable, Category = "Tile Control")
     void SetGridPosition(int32 X, int32 Y);
 
-    // ׸ ġ 
+    // 그리드 위치 가져오기
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Tile Information")
     FVector2D GetGridPosition() const { return FVector2D(GridX, GridY); }
 
-    // Ŵ 
+    // 매니저 설정
     UFUNCTION(BlueprintCallable, Category = "Manager")
     void SetOwnerManager(class AGridMazeManager* Manager);
 
-    // Ÿ β 
+    // 타일 두께 설정
     UFUNCTION(BlueprintCallable, Category = "Tile Settings")
     void SetTileThickness(float NewThickness);
 
-    // ============   Լ ============
+    // ============ 빛 제어 함수들 ============
 
-    //  ѱ
+    // 빛 켜기
     UFUNCTION(BlueprintCallable, Category = "Light Control")
     void TurnOnLight(FLinearColor Color, float Intensity);
 
-    //  
+    // 빛 끄기
     UFUNCTION(BlueprintCallable, Category = "Light Control")
     void TurnOffLight();
 
-    //   
+    // 빛 색상만 변경
     UFUNCTION(BlueprintCallable, Category = "Light Control")
     void SetLightColor(FLinearColor NewColor);
 
-    //  ⸸ 
+    // 빛 세기만 변경
     UFUNCTION(BlueprintCallable, Category = "Light Control")
     void SetLightIntensity(float NewIntensity);
 
-    // ============ ִϸ̼  ============
+    // 매니저 조명 풀 사용 여부 (사용 시 개별 조명은 끄고 발광 머티리얼만 사용)
+    UFUNCTION(BlueprintCallable, Category = "Light Control")
+    void SetUsePooledLight(bool bUsePool);
+
+    // ============ 애니메이션 제어 ============
 
-    //  
+    // 깜박임 시작
     UFUNCTION(BlueprintCallable, Category = "Animation")
-    void StartBlinking(float Duration = 0.0f);  // 0̸ 
+    void StartBlinking(float Duration = 0.0f);  // 0이면 무한
 
-    //  
+    // 깜박임 중지
     UFUNCTION(BlueprintCallable, Category = "Animation")
     void StopBlinking();
 
-    // ============ ƿƼ Լ ============
+    // ============ 유틸리티 함수들 ============
 
-    // ⺻ · 
+    // 기본 상태로 리셋
     UFUNCTION(BlueprintCallable, Category = "Appearance")
     void ResetToDefault();
 
-    //  
+    // 사운드 재생
     UFUNCTION(BlueprintCallable, Category = "Sound")
     void PlayTileSound(USoundBase* Sound);
 
@@ -232,26 +248,26 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Sound")
     void PlayWrongSound();
 
-    // ȣۿ   
+    // 상호작용 가능 여부 설정
     UFUNCTION(BlueprintCallable, Category = "Interaction")
     void SetCanBeInteracted(bool bCanInteract);
 
-    //   
+    // 현재 색상 가져오기
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Information")
     FLinearColor GetCurrentStateColor() const;
 
-    //    
+    // 현재 빛 세기 가져오기
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Information")
     float GetCurrentLightIntensity() const;
 
-    // ============ InteractableInterface  ============
+    // ============ InteractableInterface 구현 ============
 
     virtual void Interact_Implementation(AActor* Interactor) override;
     virtual bool CanInteract_Implementation(AActor* Interactor) override;
     virtual FString GetInteractionText_Implementation() override;
     virtual EInteractionType GetInteractionType_Implementation() override;
 
-    // ============ BP ̺Ʈ ============
+    // ============ BP 이벤트들 ============
 
     UFUNCTION(BlueprintImplementableEvent, Category = "Blueprint Events")
     void OnPlayerInteracted(AActor* Player);
@@ -272,10 +288,14 @@ public:
     void OnLightTurnedOff();
 
 protected:
-    FTimerHandle BlinkTimerHandle;
+    int32 BlinkAnimationHandle = INDEX_NONE;
 
 private:
-    void UpdateBlinking(float DeltaTime);
+    void ApplyBlink(float BlinkFactor);
     void ForceMobilitySettings();
     void ApplyStateVisuals(ETileState State);
+    void SetEmissiveColor(const FLinearColor& Color);
+
+    UPROPERTY(Transient)
+    class UMaterialInstanceDynamic* EmissiveMaterial;
 };
\ No newline at end of file
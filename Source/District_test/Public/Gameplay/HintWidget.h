@@ -11,7 +11,7 @@ class UImage;
 class UDataTable;
 class UHamoina_GameInstance;
 
-UCLASS(Abstract, Blueprintable)
+UCLASS(Abstract, Blueprintable, meta = (DisableNativeTick))
 class DISTRICT_TEST_API UHintWidget : public UUserWidget
 {
     GENERATED_BODY()
@@ -19,7 +19,6 @@ class DISTRICT_TEST_API UHintWidget : public UUserWidget
 public:
     virtual void NativeConstruct() override;
     virtual void NativeDestruct() override;
-    virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 
     UFUNCTION(BlueprintCallable, Category = "Hint")
     void InitializeHint(int32 InLevelNumber);
@@ -90,7 +89,8 @@ protected:
     void UpdateCooldownDisplay();
     void InitializeBlocks();
     void StartCooldown();
-    void UpdateCooldown(float DeltaTime);
+    void SyncCooldownAnimation();
+    void FinishCooldown();
     void LoadStateFromSaveGame();
     void SaveStateToSaveGame();
 
@@ -110,4 +110,6 @@ private:
     UHamoina_GameInstance* GameInstance;
     bool bIsInitialized = false;
     bool bButtonsBound = false;
+    bool bIsWidgetConstructed = false;
+    int32 CooldownAnimationHandle = INDEX_NONE;
 };
\ No newline at end of file
@@ -22,27 +22,27 @@ protected:
     virtual void BeginPlay() override;
 
 public:
-    // κ丮   
+    // 인벤토리 내 아이템 목록
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory")
     TArray<UItem*> Items;
 
-    // κ丮 ִ 뷮
+    // 인벤토리 최대 용량
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory")
     int32 Capacity;
 
-    //  õ  (UI)
+    // 현재 선택된 슬롯 (UI용)
     UPROPERTY(BlueprintReadWrite, Category = "Inventory")
     int32 CurrentSelectedSlot;
 
-    // κ丮   (UI)
+    // 인벤토리 열린 상태 (UI용)
     UPROPERTY(BlueprintReadWrite, Category = "Inventory")
     bool bIsInventoryOpen;
 
-    // κ丮  ̺Ʈ
+    // 인벤토리 변경 이벤트
     UPROPERTY(BlueprintAssignable, Category = "Inventory")
     FOnInventoryUpdated OnInventoryUpdated;
 
-    //   ߰
+    // 이 줄 추가
     UPROPERTY(BlueprintAssignable, Category = "Inventory")
     FOnSelectionChanged OnSelectionChanged;
 
@@ -56,40 +56,40 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Inventory")
     FOnInventoryToggled OnInventoryToggled;
 
-    // Ʈ  - ӿ ֿ 
+    // 노트 아이템 - 게임에서 주요 역할
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory")
     UItem* NoteItem;
 
-    //  ߰
+    // 아이템 추가
     UFUNCTION(BlueprintCallable, Category = "Inventory")
     bool AddItem(UItem* Item);
 
-    //  
+    // 아이템 제거
     UFUNCTION(BlueprintCallable, Category = "Inventory")
     bool RemoveItem(UItem* Item);
 
-    //  
+    // 아이템 사용
     UFUNCTION(BlueprintCallable, Category = "Inventory")
     void UseItem(UItem* Item);
 
-    // Ư ̸  ã
+    // 특정 이름의 아이템 찾기
     UFUNCTION(BlueprintCallable, Category = "Inventory")
     UItem* FindItemByName(const FString& ItemName);
 
-    // κ丮  ߰  Ȯ
+    // 인벤토리에 아이템 추가 가능한지 확인
     UFUNCTION(BlueprintCallable, Category = "Inventory")
     bool HasRoomForItem() const;
 
-    // Ʈ ޽ ߰ (, ޸  ߰ )
+    // 노트에 메시지 추가 (쪽지, 메모 등 발견 시)
     UFUNCTION(BlueprintCallable, Category = "Inventory")
     void AddNoteEntry(const FString& NoteText);
 
-    // UI  ο ɵ
+    // UI 관련 새로운 기능들
     UFUNCTION(BlueprintCallable, Category = "Inventory")
     void ToggleInventory();
 
     UFUNCTION(BlueprintCallable, Category = "Inventory")
-    void MoveSelection(int32 Direction); // -1 = , 1 = 
+    void MoveSelection(int32 Direction); // -1 = 왼쪽, 1 = 오른쪽
 
     UFUNCTION(BlueprintCallable, Category = "Inventory")
     void UseSelectedItem();
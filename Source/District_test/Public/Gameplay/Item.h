@@ -5,7 +5,7 @@
 #include "Item.generated.h"
 
 /**
- * ⺻  Ŭ - κ丮     ⺻ Ŭ
+ * 기본 아이템 클래스 - 인벤토리에 저장 가능한 모든 아이템의 기본 클래스
  */
 UCLASS(Blueprintable)
 class DISTRICT_TEST_API UItem : public UObject
@@ -15,7 +15,7 @@ class DISTRICT_TEST_API UItem : public UObject
 public:
 	UItem();
 
-	//  ⺻ Ӽ
+	// 아이템 기본 속성
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item")
 	FString Name;
 
@@ -31,7 +31,7 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item")
 	int32 MaxStackSize;
 
-	//   Լ - ڽ Ŭ ̵
+	// 아이템 사용 함수 - 자식 클래스에서 오버라이드
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Item")
 	void Use(AActor* User);
 	virtual void Use_Implementation(AActor* User);
@@ -35,9 +35,11 @@ public:
 
 protected:
     virtual void BeginPlay() override;
-    virtual void Tick(float DeltaTime) override;
+    virtual void PostRegisterAllComponents() override;
+    virtual void PostUnregisterAllComponents() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
-    // ============ Ʈ ============
+    // ============ 컴포넌트 ============
 
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
     USceneComponent* RootSceneComponent;
@@ -58,33 +60,33 @@ protected:
     UPointLightComponent* DisplayLight;
 
 public:
-    // ============   (BP  ) ============
+    // ============ 색상 설정 (BP에서 편집 가능) ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Display Colors|States")
-    FLinearColor ReadyColor = FLinearColor(0.2f, 1.0f, 0.2f, 1.0f);  // ʷ
+    FLinearColor ReadyColor = FLinearColor(0.2f, 1.0f, 0.2f, 1.0f);  // 초록
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Display Colors|States")
-    FLinearColor CountdownColor = FLinearColor(1.0f, 1.0f, 0.2f, 1.0f);  // 
+    FLinearColor CountdownColor = FLinearColor(1.0f, 1.0f, 0.2f, 1.0f);  // 노랑
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Display Colors|States")
-    FLinearColor PlayingColor = FLinearColor(0.2f, 0.5f, 1.0f, 1.0f);  // Ķ
+    FLinearColor PlayingColor = FLinearColor(0.2f, 0.5f, 1.0f, 1.0f);  // 파랑
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Display Colors|States")
-    FLinearColor SuccessColor = FLinearColor(0.2f, 1.0f, 0.2f, 1.0f);  //  ʷ
+    FLinearColor SuccessColor = FLinearColor(0.2f, 1.0f, 0.2f, 1.0f);  // 밝은 초록
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Display Colors|States")
-    FLinearColor FailedColor = FLinearColor(1.0f, 0.2f, 0.2f, 1.0f);  // 
+    FLinearColor FailedColor = FLinearColor(1.0f, 0.2f, 0.2f, 1.0f);  // 빨강
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Display Colors|Time Warning")
-    FLinearColor WarningColor = FLinearColor(1.0f, 0.8f, 0.2f, 1.0f);  // Ȳ
+    FLinearColor WarningColor = FLinearColor(1.0f, 0.8f, 0.2f, 1.0f);  // 주황
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Display Colors|Time Warning")
-    FLinearColor DangerColor = FLinearColor(1.0f, 0.2f, 0.2f, 1.0f);  // 
+    FLinearColor DangerColor = FLinearColor(1.0f, 0.2f, 0.2f, 1.0f);  // 빨강
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Display Colors|Progress")
-    FLinearColor ProgressColor = FLinearColor(1.0f, 1.0f, 1.0f, 1.0f);  // 
+    FLinearColor ProgressColor = FLinearColor(1.0f, 1.0f, 1.0f, 1.0f);  // 흰색
 
-    // ============ ؽƮ  ============
+    // ============ 텍스트 설정 ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Display Text|Size")
     float TimeTextSize = 50.0f;
@@ -113,7 +115,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Display Text|Messages")
     FString FailedMessage = TEXT("FAILED!");
 
-    // ============ ǥ ɼ ============
+    // ============ 표시 옵션 ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Display Options")
     bool bShowTime = true;
@@ -127,7 +129,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Display Options")
     bool bShowMilliseconds = false;
 
-    // ============ īƮٿ  ============
+    // ============ 카운트다운 설정 ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Countdown Settings")
     bool bEnableCountdown = true;
@@ -135,7 +137,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Countdown Settings")
     int32 CountdownDuration = 3;
 
-    // ============ ִϸ̼  ============
+    // ============ 애니메이션 설정 ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Animation Settings")
     bool bEnableSuccessAnimation = true;
@@ -155,7 +157,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Animation Settings")
     float BlinkSpeed = 4.0f;
 
-    // ============  Ӱ谪 ============
+    // ============ 경고 임계값 ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Warning Thresholds")
     float WarningTimeThreshold = 30.0f;
@@ -163,7 +165,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Warning Thresholds")
     float DangerTimeThreshold = 10.0f;
 
-    // ============ Ŵ  ============
+    // ============ 매니저 연결 ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Connection")
     AGridMazeManager* ManualManager;
@@ -174,7 +176,7 @@ public:
     UPROPERTY(BlueprintReadOnly, Category = "Connection")
     AGridMazeManager* ConnectedManager;
 
-    // ============   ============
+    // ============ 현재 상태 ============
 
     UPROPERTY(BlueprintReadOnly, Category = "Current State")
     EDisplayState CurrentDisplayState = EDisplayState::Ready;
@@ -204,7 +206,7 @@ public:
     bool bDangerTriggered = false;
 
 public:
-    // ============ ̺Ʈ Ʈ ============
+    // ============ 이벤트 델리게이트 ============
 
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FOnDisplayStateChangedDelegate OnDisplayStateChanged_Event;
@@ -215,107 +217,107 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FOnCountdownFinishedDelegate OnCountdownFinished_Event;
 
-    // ============ BP ȣ  ֿ Լ ============
+    // ============ BP에서 호출 가능한 주요 함수들 ============
 
-    // ÷  
+    // 디스플레이 상태 설정
     UFUNCTION(BlueprintCallable, Category = "Display Control")
     void SetDisplayState(EDisplayState NewState);
 
-    // ð Ʈ
+    // 시간 업데이트
     UFUNCTION(BlueprintCallable, Category = "Display Control")
     void UpdateTime(float TimeRemaining);
 
-    // ൵ Ʈ
+    // 진행도 업데이트
     UFUNCTION(BlueprintCallable, Category = "Display Control")
     void UpdateProgress(int32 Current, int32 Max);
 
-    // ޽ ǥ
+    // 메시지 표시
     UFUNCTION(BlueprintCallable, Category = "Display Control")
     void ShowMessage(const FString& Message, FLinearColor Color);
 
-    // Ŀ ޽ ǥ ()
+    // 커스텀 메시지 표시 (색상만)
     UFUNCTION(BlueprintCallable, Category = "Display Control")
     void ShowCustomMessage(const FString& Message);
 
-    // ÷ ʱȭ
+    // 디스플레이 초기화
     UFUNCTION(BlueprintCallable, Category = "Display Control")
     void ClearDisplay();
 
-    // ============ īƮٿ  ============
+    // ============ 카운트다운 제어 ============
 
-    // īƮٿ 
+    // 카운트다운 시작
     UFUNCTION(BlueprintCallable, Category = "Countdown")
     void StartCountdown();
 
-    // īƮٿ 
+    // 카운트다운 중지
     UFUNCTION(BlueprintCallable, Category = "Countdown")
     void StopCountdown();
 
-    // ============ ִϸ̼  ============
+    // ============ 애니메이션 제어 ============
 
-    //  
+    // 깜박임 시작
     UFUNCTION(BlueprintCallable, Category = "Animation")
     void StartBlinking();
 
-    //  
+    // 깜박임 중지
     UFUNCTION(BlueprintCallable, Category = "Animation")
     void StopBlinking();
 
-    // ============ Ŵ  ============
+    // ============ 매니저 연결 ============
 
-    // Ŵ 
+    // 매니저 연결
     UFUNCTION(BlueprintCallable, Category = "Connection")
     void ConnectToManager(AGridMazeManager* Manager);
 
-    // Ŵ  
+    // 매니저 연결 해제
     UFUNCTION(BlueprintCallable, Category = "Connection")
     void DisconnectFromManager();
 
-    // ڵ Ŵ ãƼ 
+    // 자동으로 매니저 찾아서 연결
     UFUNCTION(BlueprintCallable, Category = "Connection")
     void AutoConnectToManager();
 
-    // ============   Լ ============
+    // ============ 설정 변경 함수들 ============
 
-    // ð ؽƮ ũ 
+    // 시간 텍스트 크기 설정
     UFUNCTION(BlueprintCallable, Category = "Settings")
     void SetTimeTextSize(float NewSize);
 
-    //  ؽƮ ũ 
+    // 상태 텍스트 크기 설정
     UFUNCTION(BlueprintCallable, Category = "Settings")
     void SetStatusTextSize(float NewSize);
 
-    // ൵ ؽƮ ũ 
+    // 진행도 텍스트 크기 설정
     UFUNCTION(BlueprintCallable, Category = "Settings")
     void SetProgressTextSize(float NewSize);
 
-    //  ϰ 
+    // 색상 일괄 설정
     UFUNCTION(BlueprintCallable, Category = "Settings")
     void SetDisplayColors(FLinearColor Ready, FLinearColor Playing, FLinearColor Success, FLinearColor Failed);
 
-    // ޽ ϰ 
+    // 메시지 일괄 설정
     UFUNCTION(BlueprintCallable, Category = "Settings")
     void SetDisplayMessages(const FString& Ready, const FString& Success, const FString& Failed);
 
-    // ============  ȸ Լ ============
+    // ============ 정보 조회 함수들 ============
 
-    //   
+    // 현재 상태 가져오기
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Information")
     EDisplayState GetCurrentState() const { return CurrentDisplayState; }
 
-    // ð 
+    // 시간 포맷팅
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Information")
     FString FormatTime(float TimeInSeconds);
 
-    // ൵ 
+    // 진행도 포맷팅
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Information")
     FString FormatProgress(int32 Current, int32 Max);
 
-    // Ŵ  
+    // 매니저 연결 여부
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Information")
     bool IsConnectedToManager() const { return ConnectedManager != nullptr; }
 
-    // ============ BP ̺Ʈ ============
+    // ============ BP 이벤트들 ============
 
     UFUNCTION(BlueprintImplementableEvent, Category = "Blueprint Events")
     void OnDisplayStateChanged(EDisplayState NewState);
@@ -338,7 +340,7 @@ public:
     UFUNCTION(BlueprintImplementableEvent, Category = "Blueprint Events")
     void OnDisconnectedFromManager();
 
-    // ============ BP Ŀ͸  Լ ============
+    // ============ BP에서 커스터마이즈 가능한 함수들 ============
 
     UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Custom Logic")
     FString CustomFormatTime(float TimeInSeconds);
@@ -353,7 +355,7 @@ public:
     virtual void CustomUpdateDisplay_Implementation(float TimeRemaining, EPuzzleState PuzzleState) {}
 
 protected:
-    // ============  ̺Ʈ ݹ ============
+    // ============ 내부 이벤트 콜백들 ============
 
     UFUNCTION()
     void OnPuzzleStateChanged(EPuzzleState NewState);
@@ -368,8 +370,14 @@ private:
     void UpdateLightColor(FLinearColor Color);
     void HandleTimeWarnings(float TimeRemaining, float TotalTime);
     void SetupProgressText();
+    void InvalidateTimeCache();
+
+    // 마지막으로 적용한 시간 표시 (같은 값이면 텍스트/조명 갱신 생략)
+    FString CachedTimeString;
+    FLinearColor CachedTimeColor = FLinearColor::Transparent;
+    bool bHasCachedTimeColor = false;
 
     FTimerHandle CountdownTimerHandle;
     FTimerHandle MessageTimerHandle;
-    float BlinkTimer = 0.0f;
+    int32 BlinkAnimationHandle = INDEX_NONE;
 };
\ No newline at end of file
@@ -0,0 +1,76 @@
+// MazePathGenerator.h
+#pragma once
+#include "CoreMinimal.h"
+#include "MazePathGenerator.generated.h"
+
+UENUM(BlueprintType)
+enum class EMazePathShape : uint8
+{
+    RandomWalk      UMETA(DisplayName = "Random Walk"),
+    Hamiltonian     UMETA(DisplayName = "Hamiltonian (All Cells)")
+};
+
+USTRUCT(BlueprintType)
+struct DISTRICT_TEST_API FMazePathSettings
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Path Generator")
+    EMazePathShape Shape = EMazePathShape::RandomWalk;
+
+    // Fraction of the grid a random walk covers; Hamiltonian paths always cover every cell
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Path Generator", meta = (ClampMin = "0.05", ClampMax = "1.0", EditCondition = "Shape == EMazePathShape::RandomWalk"))
+    float Coverage = 0.4f;
+
+    // Target fraction of path cells where the path changes direction
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Path Generator", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float TurnFrequency = 0.5f;
+
+    // How strongly a random walk folds back along its own trail instead of heading into open space
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Path Generator", meta = (ClampMin = "0.0", ClampMax = "1.0", EditCondition = "Shape == EMazePathShape::RandomWalk"))
+    float BacktrackBias = 0.3f;
+
+    // Starts the path on row 0, the edge next to the starting floor
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Path Generator")
+    bool bStartOnNearEdge = true;
+
+    // 0 picks a new seed every time; otherwise the same seed and generation always give the same path
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Path Generator")
+    int32 Seed = 0;
+};
+
+// Builds CorrectPath layouts for AGridMazeManager: self-avoiding random walks, or Hamiltonian
+// paths mixed with backbite moves from a serpentine. Cells are (X = row, Y = column) and
+// consecutive cells are always orthogonal neighbours, so the result passes ValidateCorrectPath.
+class DISTRICT_TEST_API FMazePathGenerator
+{
+public:
+    // Returns an empty path for grids with fewer than two cells
+    static TArray<FIntPoint> Generate(int32 Rows, int32 Columns, const FMazePathSettings& Settings, FRandomStream& Random);
+
+private:
+    FMazePathGenerator(int32 InRows, int32 InColumns, const FMazePathSettings& InSettings, FRandomStream& InRandom);
+
+    bool BuildRandomWalk(int32 TargetLength, TArray<int32>& OutPath);
+    void BuildHamiltonian(TArray<int32>& OutPath);
+    void BuildSerpentine(TArray<int32>& OutPath, int32& OutTurns);
+
+    // Links one end to a random grid neighbour and reverses the stretch between them
+    bool Backbite(TArray<int32>& Path, bool bTail, int32& InOutTurns, bool bFollowTurnTarget);
+
+    bool MaySplitFreeCells(int32 Cell, const TBitArray<>& Used) const;
+    int32 CountReachable(int32 From, const TBitArray<>& Used, int32 Limit);
+    int32 GetNeighbours(int32 Cell, int32 OutNeighbours[4]) const;
+    bool IsTurn(int32 A, int32 B, int32 C) const;
+    bool IsOnNearEdge(int32 Cell) const { return Cell / Columns == 0; }
+
+    int32 Rows;
+    int32 Columns;
+    int32 NumCells;
+    FMazePathSettings Settings;
+    FRandomStream& Random;
+
+    TArray<int32> PathIndex;
+    TArray<int32> ScratchQueue;
+    TBitArray<> ScratchSeen;
+};
@@ -0,0 +1,54 @@
+// MazePreviewSequencer.h
+#pragma once
+#include "CoreMinimal.h"
+
+struct FMazePreviewChange
+{
+    FIntPoint Cell = FIntPoint(-1, -1);
+    int32 PathIndex = INDEX_NONE;
+
+    // False when a loop restart turns the cell back off
+    bool bLit = true;
+};
+
+// One timeline for the correct-path preview. Path cells light up StepInterval apart (scaled by
+// the speed) and the preview ends one interval after the last cell. The timeline only tracks how
+// many cells should be lit; the lit cells are always a prefix of the path, so a skip or a loop
+// restart costs nothing until the changes are handed out in bounded batches.
+class DISTRICT_TEST_API FMazePreviewSequencer
+{
+public:
+    void Start(const TArray<FIntPoint>& InPath, float InStepInterval, bool bInLoop);
+    void Stop();
+    void Advance(float DeltaTime);
+
+    // Lights every remaining cell and ends once they are handed out, even when looping
+    void SkipToEnd();
+
+    void SetSpeed(float InSpeed) { Speed = FMath::Max(0.0f, InSpeed); }
+    void SetLooping(bool bInLoop) { bLoop = bInLoop; }
+
+    // Appends up to MaxChanges pending changes, lights in path order and unlights from the end
+    int32 ConsumeChanges(TArray<FMazePreviewChange>& OutChanges, int32 MaxChanges);
+
+    bool IsActive() const { return bActive; }
+    bool IsFinished() const { return bActive && bEnded && AppliedLit == DesiredLit; }
+    bool HasPendingChanges() const { return AppliedLit != DesiredLit; }
+    float GetSpeed() const { return Speed; }
+    int32 GetLitCount() const { return AppliedLit; }
+
+private:
+    void UpdateDesiredLit();
+
+    TArray<FIntPoint> Path;
+    float StepInterval = 0.5f;
+    float Speed = 1.0f;
+    double Time = 0.0;
+
+    bool bActive = false;
+    bool bLoop = false;
+    bool bEnded = false;
+
+    int32 DesiredLit = 0;
+    int32 AppliedLit = 0;
+};
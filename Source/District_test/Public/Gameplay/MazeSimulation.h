@@ -0,0 +1,168 @@
+// MazeSimulation.h
+#pragma once
+#include "CoreMinimal.h"
+#include "MazeSimulation.generated.h"
+
+UENUM(BlueprintType)
+enum class EPuzzleState : uint8
+{
+    Ready       UMETA(DisplayName = "Ready"),
+    Playing     UMETA(DisplayName = "Playing"),
+    Success     UMETA(DisplayName = "Success"),
+    Failed      UMETA(DisplayName = "Failed")
+};
+
+enum class EMazeSimEvent : uint8
+{
+    StateChanged,   // State
+    CorrectStep,    // Cell, PathIndex after advancing
+    NextStep,       // Cell expected next
+    WrongStep,      // Cell
+    WrongReset,     // Cell of the wrong step; PathIndex is back to 0
+    TimerChanged,   // Time; only when the displayed value changes
+    TimeWarning,    // Time; once per run, when the clock drops to the threshold
+    Completed,
+    Failed,
+    FailReset       // FailResetDelay ran out after a failure
+};
+
+struct FMazeSimEventData
+{
+    EMazeSimEvent Type = EMazeSimEvent::StateChanged;
+    EPuzzleState State = EPuzzleState::Ready;
+    FIntPoint Cell = FIntPoint(-1, -1);
+    int32 PathIndex = 0;
+    float Time = 0.0f;
+};
+
+enum class EMazeStepResult : uint8
+{
+    Ignored,
+    Started,
+    Correct,
+    Wrong,
+    Completed
+};
+
+struct FMazeSimSettings
+{
+    float TimeLimit = 60.0f;
+    bool bContinueTimeOnFail = true;
+    float WrongResetDelay = 0.5f;
+    float FailResetDelay = 15.0f;
+
+    float TimeWarningThreshold = 10.0f;
+
+    // TimerChanged resolution above and at or below TimeWarningThreshold
+    float TimerStep = 1.0f;
+    float WarningTimerStep = 0.1f;
+};
+
+// The grid maze rules without actors: path progress, wrong-step and failure resets, the clock
+// and per-cell progress. Every change is queued as an event, so AGridMazeManager only maps
+// events to tiles, sounds and Blueprint callbacks, and bots or commandlets can step it directly.
+// The clock is computed from the timestamp it last started at, so callers can advance the
+// simulation only when GetTimeUntilNextUpdate says something will change.
+class DISTRICT_TEST_API FMazeSimulation
+{
+public:
+    FMazeSimSettings Settings;
+
+    // Cells are (X = row, Y = column). Progress survives when the layout is unchanged.
+    void SetLayout(int32 InRows, int32 InColumns, const TArray<FIntPoint>& InPath);
+
+    bool Start();
+    EMazeStepResult Step(FIntPoint Cell);
+
+    // Moves the simulation clock forward; earlier timestamps are ignored
+    void AdvanceTo(double InNow);
+    void Tick(float DeltaTime) { AdvanceTo(Now + DeltaTime); }
+
+    // Seconds until the next TimerChanged, TimeWarning, timeout or pending reset; negative when nothing is scheduled
+    double GetTimeUntilNextUpdate() const;
+
+    void Complete();
+    void Fail();
+
+    // Back to Ready with a full clock; pending wrong-step and failure resets are dropped
+    void Reset();
+
+    // Back to the first path cell while still playing
+    void RestartPath();
+
+    void SetPaused(bool bInPaused);
+    void SetShowingPreview(bool bInShowingPreview) { bShowingPreview = bInShowingPreview; }
+    void SetTimeRemaining(float InTimeRemaining);
+
+    // Returns false when the cell was already marked or is off the grid
+    bool MarkCompleted(FIntPoint Cell);
+    bool MarkFailed(FIntPoint Cell);
+    bool IsCompleted(FIntPoint Cell) const;
+    bool IsFailed(FIntPoint Cell) const;
+    void ClearProgress();
+
+    // Marked cells in marking order
+    const TArray<FIntPoint>& GetCompletedLog() const { return CompletedLog; }
+    const TArray<FIntPoint>& GetFailedLog() const { return FailedLog; }
+
+    EPuzzleState GetState() const { return State; }
+    int32 GetPathIndex() const { return PathIndex; }
+    float GetTimeRemaining() const { return TimeRemaining; }
+    double GetNow() const { return Now; }
+    bool IsClockRunning() const { return ClockStartTime >= 0.0; }
+    bool IsPaused() const { return bPaused; }
+    bool IsShowingPreview() const { return bShowingPreview; }
+    int32 GetRows() const { return Rows; }
+    int32 GetColumns() const { return Columns; }
+    const TArray<FIntPoint>& GetPath() const { return Path; }
+    FIntPoint GetExpectedCell() const { return Path.IsValidIndex(PathIndex) ? Path[PathIndex] : FIntPoint(-1, -1); }
+    bool IsValidCell(FIntPoint Cell) const { return Cell.X >= 0 && Cell.X < Rows && Cell.Y >= 0 && Cell.Y < Columns; }
+
+    // Moves out the events queued since the last call, oldest first
+    void ConsumeEvents(TArray<FMazeSimEventData>& OutEvents);
+    bool HasEvents() const { return Events.Num() > 0; }
+    void ClearEvents() { Events.Reset(); }
+
+private:
+    void SetState(EPuzzleState NewState);
+    FMazeSimEventData& Emit(EMazeSimEvent Type);
+
+    // Brings TimeRemaining up to Now, then starts or stops the clock to match the state
+    void RefreshClock();
+    void EmitTimerIfChanged();
+    void RestartTimerEvents();
+    float GetTimerStep(float Time) const;
+    double QuantizeTime(float Time) const;
+    int32 ToIndex(FIntPoint Cell) const { return IsValidCell(Cell) ? Cell.X * Columns + Cell.Y : INDEX_NONE; }
+
+    int32 Rows = 0;
+    int32 Columns = 0;
+    TArray<FIntPoint> Path;
+
+    EPuzzleState State = EPuzzleState::Ready;
+    int32 PathIndex = 0;
+    float TimeRemaining = 0.0f;
+    bool bPaused = false;
+    bool bShowingPreview = false;
+
+    double Now = 0.0;
+
+    // Negative while the clock is stopped
+    double ClockStartTime = -1.0;
+    float ClockStartRemaining = 0.0f;
+
+    double LastTimerValue = -1.0;
+    bool bTimeWarningSent = false;
+
+    // Timestamps of pending resets, negative while none is pending
+    double WrongResetTime = -1.0;
+    double FailResetTime = -1.0;
+    FIntPoint WrongCell = FIntPoint(-1, -1);
+
+    TBitArray<> CompletedCells;
+    TBitArray<> FailedCells;
+    TArray<FIntPoint> CompletedLog;
+    TArray<FIntPoint> FailedLog;
+
+    TArray<FMazeSimEventData> Events;
+};
@@ -18,7 +18,6 @@ protected:
     virtual void BeginPlay() override;
     void UpdateWidgetPosition();
 public:
-    virtual void Tick(float DeltaTime) override;
 
 
     UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "Components")
@@ -37,7 +36,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pickup")
     FString CustomItemDescription;
 
-    // ̽ 
+    // 인터페이스 구현
     UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Interaction")
     void Interact(AActor* Interactor);
     virtual void Interact_Implementation(AActor* Interactor) override;
@@ -78,11 +77,11 @@ public:
 
 
 
-    // ޽ ȸ 
+    // 메시 회전 설정
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Appearance", meta = (ExposeOnSpawn = true))
     FRotator MeshRotation = FRotator::ZeroRotator;
 
-    // ȸ  Լ
+    // 회전 관련 함수들
     UFUNCTION(BlueprintCallable, Category = "Appearance")
     void ApplyMeshRotation();
 
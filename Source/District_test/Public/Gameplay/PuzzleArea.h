@@ -73,14 +73,14 @@ class DISTRICT_TEST_API APuzzleArea : public AActor
 public:
     APuzzleArea();
 
-    // Components - AreaBox  
+    // Components - AreaBox는 독립적으로 존재
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
     USceneComponent* GridRoot;
 
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
     UBoxComponent* AreaBox;
 
-    // Area Box Settings -  ׸  
+    // Area Box Settings - 퍼즐 그리드와 완전히 독립적
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Area Box")
     FVector AreaBoxExtent = FVector(750.0f, 750.0f, 200.0f);
 
@@ -215,6 +215,8 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void PostRegisterAllComponents() override;
+    virtual void PostUnregisterAllComponents() override;
     virtual void OnConstruction(const FTransform& Transform) override;
 
 #if WITH_EDITOR
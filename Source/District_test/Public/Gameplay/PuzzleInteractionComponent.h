@@ -29,12 +29,12 @@ public:
     bool bMatchCameraRotation = true;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics")
-    bool bStartWithPhysicsDisabled = true; // ⺻  Ȱȭ 
+    bool bStartWithPhysicsDisabled = true; // 기본적으로 피직스 비활성화로 시작
 
     bool bIsPhysicsSimulating;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics")
-    bool bEnablePhysicsWhenDropped = true; // ߸   Ȱȭ
+    bool bEnablePhysicsWhenDropped = true; // 떨어뜨릴 때 피직스 활성화
 
     UPROPERTY(BlueprintReadOnly, Category = "Puzzle")
     class APedestal* CurrentPedestal;
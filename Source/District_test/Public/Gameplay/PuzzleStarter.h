@@ -81,12 +81,12 @@ protected:
     USphereComponent* InteractionSphere;
 
 public:
-    // ============   ============
+    // ============ 연결 설정 ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Connection")
     AGridMazeManager* ConnectedMazeManager;
 
-    // ============ ھ   ============
+    // ============ 코어 슬롯 설정 ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Core Slots")
     TArray<FCoreSlot> CoreSlots;
@@ -94,7 +94,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Core Slots")
     bool bAutoStartWhenComplete = true;
 
-    // ============ ־  ============
+    // ============ 비주얼 설정 ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Visual")
     FLinearColor EmptySlotColor = FLinearColor(0.3f, 0.3f, 0.3f, 1.0f);
@@ -105,7 +105,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Visual")
     float SlotSize = 50.0f;
 
-    // ============   ============
+    // ============ 사운드 설정 ============
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sound")
     USoundBase* CoreInsertSound;
@@ -119,7 +119,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sound")
     float SoundVolume = 1.0f;
 
-    // ============  ============
+    // ============ 상태 ============
 
     UPROPERTY(BlueprintReadOnly, Category = "State")
     bool bAllCoresInserted = false;
@@ -130,7 +130,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Visual")
     UStaticMesh* SlotMeshAsset;
 
-    // ============ Ʈ ============
+    // ============ 델리게이트 ============
 
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FOnCoreInserted OnCoreInserted;
@@ -141,38 +141,38 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FOnWrongCoreInserted OnWrongCoreInserted;
 
-    // ============ ֿ Լ ============
+    // ============ 주요 함수 ============
 
-    // ھ  õ (BP ȣ)
+    // 코어 삽입 시도 (BP에서 호출)
     UFUNCTION(BlueprintCallable, Category = "Puzzle")
     bool TryInsertCore(AActor* CoreActor);
 
-    //   ä Ȯ
+    // 모든 슬롯이 채워졌는지 확인
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Puzzle")
     bool AreAllSlotsFilled() const;
 
-    // Ư  ִ Ȯ
+    // 특정 슬롯이 비어있는지 확인
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Puzzle")
     bool IsSlotEmpty(int32 SlotIndex) const;
 
-    //  
+    // 퍼즐 시작
     UFUNCTION(BlueprintCallable, Category = "Puzzle")
     void StartConnectedPuzzle();
 
     UFUNCTION(BlueprintCallable, Category = "Puzzle")
     bool TryInsertCoreByTag(FName CoreTag);
 
-    //  
+    // 슬롯 리셋
     UFUNCTION(BlueprintCallable, Category = "Puzzle")
     void ResetAllSlots();
 
-    // InteractableInterface 
+    // InteractableInterface 구현
     virtual void Interact_Implementation(AActor* Interactor) override;
     virtual bool CanInteract_Implementation(AActor* Interactor) override;
     virtual FString GetInteractionText_Implementation() override;
     virtual EInteractionType GetInteractionType_Implementation() override;
 
-    // ============ BP ̺Ʈ ============
+    // ============ BP 이벤트 ============
 
     UFUNCTION(BlueprintImplementableEvent, Category = "Events")
     void OnCoreInsertedBP(FName CoreTag, int32 SlotIndex);
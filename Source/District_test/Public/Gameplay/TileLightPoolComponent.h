@@ -0,0 +1,89 @@
+// TileLightPoolComponent.h
+#pragma once
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "TileLightPoolComponent.generated.h"
+
+class AGridMazeManager;
+class UPointLightComponent;
+
+// Drives a fixed number of point lights for an AGridMazeManager grid. Lights go to highlighted
+// tiles first (FirstStep / Wrong / Correct / Preview), then to lit tiles nearest the player;
+// every other tile falls back to its emissive material.
+UCLASS(ClassGroup = (Puzzle), meta = (BlueprintSpawnableComponent))
+class DISTRICT_TEST_API UTileLightPoolComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UTileLightPoolComponent();
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Light Pool")
+    bool bEnableLightPool = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Light Pool", meta = (ClampMin = "0"))
+    int32 MaxActiveLights = 8;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Light Pool", meta = (ClampMin = "0.0"))
+    float ReassignInterval = 0.2f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Light Pool")
+    bool bPooledLightsCastShadows = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Light Pool")
+    float LightRadius = 500.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Light Pool")
+    float LightHeight = 150.0f;
+
+    // Used for batched grids, which have no tile actor to read an intensity from
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Light Pool")
+    float BatchedLightIntensity = 1500.0f;
+
+    UFUNCTION(BlueprintCallable, Category = "Light Pool")
+    void RefreshAssignments();
+
+    UFUNCTION(BlueprintCallable, Category = "Light Pool")
+    void SetMaxActiveLights(int32 NewMax);
+
+    UFUNCTION(BlueprintCallable, Category = "Light Pool")
+    void SetLightPoolEnabled(bool bEnabled);
+
+    UFUNCTION(BlueprintPure, Category = "Light Pool")
+    int32 GetActiveLightCount() const;
+
+    bool IsPoolActive() const { return bEnableLightPool && MaxActiveLights > 0; }
+
+private:
+    struct FLightAssignment
+    {
+        FIntPoint Cell = FIntPoint(-1, -1);
+        float BaseIntensity = 0.0f;
+        float BlinkSpeed = 0.0f;
+        bool bBlink = false;
+    };
+
+    void EnsurePool();
+    void ReleasePool();
+
+    // Rebuilds the pool for the current settings and tells every grid tile whether to leave
+    // its own light to the pool
+    void ApplyPoolState();
+    void UpdateBlinkingLights();
+    AGridMazeManager* GetManager() const;
+
+    UPROPERTY(Transient)
+    TArray<UPointLightComponent*> PooledLights;
+
+    // Parallel to PooledLights
+    TArray<FLightAssignment> Assignments;
+
+    float TimeSinceReassign = 0.0f;
+};
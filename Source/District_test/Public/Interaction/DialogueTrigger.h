@@ -25,12 +25,12 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
 	UStaticMeshComponent* DebugMesh;
 
-	// Ŭ   Ʈ ߰
+	// 클래스 선언 위에 델리게이트 추가
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnDialogueTriggerActivated, FString, DialogueID, UDataTable*, DataTable);
 
-	// Dialogue Settings ( ϸ鼭 ߰)
+	// Dialogue Settings (기존 유지하면서 추가)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
-	FString DialogueSceneID = "Scene01_001"; // ⺻ ߰
+	FString DialogueSceneID = "Scene01_001"; // 기본값 추가
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
 	bool bOneTimeOnly = true;
@@ -38,7 +38,7 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
 	bool bAutoGetFromCharacter = true;
 
-	//  ߰
+	// 새로 추가
 	UPROPERTY(BlueprintAssignable, Category = "Dialogue Events")
 	FOnDialogueTriggerActivated OnDialogueTriggerActivated;
 
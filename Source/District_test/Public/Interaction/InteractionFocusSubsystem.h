@@ -0,0 +1,71 @@
+// InteractionFocusSubsystem.h
+#pragma once
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "InteractionFocusSubsystem.generated.h"
+
+USTRUCT(BlueprintType)
+struct DISTRICT_TEST_API FInteractionFocusStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interaction Focus")
+    float TracesPerSecond = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interaction Focus")
+    float FocusChangesPerSecond = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interaction Focus")
+    int32 TotalTraces = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interaction Focus")
+    int32 TotalSkippedUpdates = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Interaction Focus")
+    int32 TotalFocusChanges = 0;
+};
+
+// Per-viewer camera state from the last focus trace
+struct FInteractionFocusViewState
+{
+    FVector LastLocation = FVector::ZeroVector;
+    FVector LastForward = FVector::ForwardVector;
+    double LastTraceTime = -1.0;
+    bool bForceRefresh = true;
+};
+
+UCLASS()
+class DISTRICT_TEST_API UInteractionFocusSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    bool ShouldRetrace(FInteractionFocusViewState& ViewState, const FVector& ViewLocation, const FVector& ViewForward,
+        float MoveThreshold, float AngleThresholdDegrees, float RefreshInterval);
+
+    bool ImplementsInteractable(const AActor* Actor);
+
+    void RecordTrace();
+    void RecordSkippedUpdate();
+    void RecordFocusChange();
+
+    UFUNCTION(BlueprintPure, Category = "Interaction Focus")
+    FInteractionFocusStats GetFocusStats() const { return Stats; }
+
+    UFUNCTION(BlueprintCallable, Category = "Interaction Focus")
+    void ResetFocusStats();
+
+private:
+    void UpdateRates();
+
+    TMap<TObjectKey<UClass>, bool> InterfaceCache;
+
+    FInteractionFocusStats Stats;
+
+    double WindowStartTime = 0.0;
+    int32 WindowTraces = 0;
+    int32 WindowFocusChanges = 0;
+};
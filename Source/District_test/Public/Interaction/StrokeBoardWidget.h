@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/Widget.h"
+#include "StrokeBoardWidget.generated.h"
+
+class SStrokeBoard;
+class UStrokeGrid;
+
+// UMG wrapper around SStrokeBoard; draws the whole grid as one widget instead of a cell widget per position
+UCLASS()
+class DISTRICT_TEST_API UStrokeBoardWidget : public UWidget
+{
+    GENERATED_BODY()
+
+public:
+    void SetGrid(UStrokeGrid* InGrid);
+
+    // Repaints after the grid state changed
+    void Refresh();
+
+    virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+
+protected:
+    virtual TSharedRef<SWidget> RebuildWidget() override;
+
+    void HandleCellClicked(FIntPoint GridPosition);
+
+    UPROPERTY(Transient)
+    TObjectPtr<UStrokeGrid> Grid;
+
+    TSharedPtr<SStrokeBoard> MyBoard;
+};
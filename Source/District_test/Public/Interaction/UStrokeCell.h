@@ -52,6 +52,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Path")
     void UpdatePathConnections(const TArray<FIntPoint>& VisitedPath, FIntPoint CurrentPos);
 
+    // Same as UpdatePathConnections when the caller already knows this cell's path index
+    void SetPathConnections(int32 PathIndex, const TArray<FIntPoint>& VisitedPath, FIntPoint CurrentPos);
+
     UFUNCTION(BlueprintImplementableEvent, Category = "Path")
     void DrawPathLines();
 
@@ -64,6 +67,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Stroke Cell")
     void SetCellData(const FStrokeCellData& NewCellData);
 
+    // Clears per-game state before the grid rebinds this cell to another position
+    void ResetForReuse();
+
     UFUNCTION(BlueprintCallable, Category = "Stroke Cell")
     void UpdateVisuals();
 
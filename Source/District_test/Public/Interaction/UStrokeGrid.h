@@ -7,10 +7,17 @@
 #include "Components/Button.h"
 #include "Components/Image.h"
 #include "Core/StrokeGameTypes.h"
+#include "Core/StrokeGridLayout.h"
+#include "Core/StrokeStageGenerator.h"
+#include "Core/StrokeHintEngine.h"
+#include "Core/PuzzleReplay.h"
+#include "Core/StrokeStagePack.h"
 #include "Interaction/UStrokeCell.h"
 #include "Engine/DataTable.h"
 #include "UStrokeGrid.generated.h"
 
+class UStrokeBoardWidget;
+
 UCLASS()
 class DISTRICT_TEST_API UStrokeGrid : public UUserWidget
 {
@@ -21,6 +28,7 @@ public:
 
 protected:
     virtual void NativeConstruct() override;
+    virtual void NativeDestruct() override;
     virtual FReply NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent) override;
 
 public:
@@ -132,6 +140,17 @@ public:
     UPROPERTY(BlueprintReadOnly, Category = "Path Display")
     FLinearColor CurrentPathLineColor;
 
+    // Draws the grid as a single Slate widget instead of one UStrokeCell per position.
+    // Cell Blueprint visuals (DrawPathLines, PlayerIcon) are not used in this mode.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Board Renderer")
+    bool bUseBoardRenderer = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Board Renderer", meta = (EditCondition = "bUseBoardRenderer"))
+    FLinearColor BoardPlayerColor = FLinearColor(1.0f, 0.85f, 0.1f, 1.0f);
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Board Renderer", meta = (EditCondition = "bUseBoardRenderer"))
+    UTexture2D* BoardPlayerImage;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Clear Message")
     FString ClearMessage = TEXT("Clear!");
 
@@ -156,6 +175,16 @@ public:
     UFUNCTION(BlueprintImplementableEvent, Category = "Game Events")
     void OnProgressReset();
 
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hints")
+    bool bShowHints = false;
+
+    // Asks for the next correct move; the answer arrives later through OnHintReady
+    UFUNCTION(BlueprintCallable, Category = "Hints")
+    void RequestHint();
+
+    UFUNCTION(BlueprintImplementableEvent, Category = "Hints")
+    void OnHintReady(EStrokeHintResult Result, FIntPoint Direction, FIntPoint TargetPosition);
+
     UPROPERTY(meta = (BindWidget), BlueprintReadWrite, Category = "Widgets")
     class UTextBlock* StatusText;
 
@@ -165,8 +194,10 @@ public:
     UPROPERTY(meta = (BindWidget), BlueprintReadWrite, Category = "Widgets")
     class UButton* ResetButton;
 
+    // Soft so packaged games that read stages from the pack never load the table; it is only
+    // loaded when the pack is missing or lacks the requested stage, and by the editor tools.
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stage")
-    UDataTable* StageDataTable;
+    TSoftObjectPtr<UDataTable> StageDataTable;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stage")
     int32 CurrentStageNumber = 1;
@@ -174,6 +205,11 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stage")
     FName CurrentStageRowName = TEXT("Stage_01");
 
+    // Cooked from StageDataTable by CookStagePack, relative to Content. Packaged games load
+    // Stage_NN rows from it on demand; the editor keeps reading the table so edits show up directly.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stage")
+    FString StagePackPath = TEXT("StagePacks/StrokeStages.hsp");
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Editor Mode")
     bool bEditMode = false;
 
@@ -241,6 +277,9 @@ public:
     UFUNCTION(BlueprintCallable, CallInEditor, Category = "Stage Editor")
     void SaveCurrentToDataTable();
 
+    UFUNCTION(BlueprintCallable, CallInEditor, Category = "Stage Editor")
+    void CookStagePack();
+
     UFUNCTION(BlueprintCallable, CallInEditor, Category = "Editor")
     void ApplyEditorSettings();
 
@@ -262,6 +301,18 @@ public:
     UFUNCTION(BlueprintCallable, CallInEditor, Category = "Editor")
     void AutoCompleteTeleportPairs();
 
+    UFUNCTION(BlueprintCallable, CallInEditor, Category = "Editor")
+    void CheckSolvable();
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stage Generator")
+    FStrokeGeneratorSettings GeneratorSettings;
+
+    UFUNCTION(BlueprintCallable, CallInEditor, Category = "Stage Generator")
+    void GenerateStageInEditor();
+
+    UFUNCTION(BlueprintCallable, CallInEditor, Category = "Stage Generator")
+    void GenerateStagesToDataTable();
+
     UFUNCTION(BlueprintCallable, Category = "Editor")
     void OnCellEditClicked(FIntPoint Position);
 
@@ -295,9 +346,56 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Stroke Game")
     void ResetGame();
 
+    // Steps back one move, refreshing only the cells that move touched
+    UFUNCTION(BlueprintCallable, Category = "Stroke Game|Undo")
+    bool UndoMove();
+
+    UFUNCTION(BlueprintCallable, Category = "Stroke Game|Undo")
+    bool RedoMove();
+
+    UFUNCTION(BlueprintPure, Category = "Stroke Game|Undo")
+    bool CanUndo() const { return UndoStack.Num() > 0; }
+
+    UFUNCTION(BlueprintPure, Category = "Stroke Game|Undo")
+    bool CanRedo() const { return RedoStack.Num() > 0; }
+
+    // Remembers the current move; RestoreCheckpoint undoes back to it
+    UFUNCTION(BlueprintCallable, Category = "Stroke Game|Undo")
+    void SaveCheckpoint();
+
+    UFUNCTION(BlueprintCallable, Category = "Stroke Game|Undo")
+    bool RestoreCheckpoint();
+
+    // Resets the game and records every input until recording stops or another stage loads
+    UFUNCTION(BlueprintCallable, Category = "Replay")
+    void StartReplayRecording();
+
+    UFUNCTION(BlueprintCallable, Category = "Replay")
+    void StopReplayRecording();
+
+    // Relative paths go under Saved/Replays
+    UFUNCTION(BlueprintCallable, Category = "Replay")
+    bool SaveReplay(const FString& FilePath) const;
+
+    // Resets the game and re-runs a session recorded on this stage; Speed 0 applies it at once
+    UFUNCTION(BlueprintCallable, Category = "Replay")
+    bool PlayReplay(const FString& FilePath, float Speed = 0.0f);
+
     UFUNCTION(BlueprintCallable, Category = "Stroke Game")
     FIntPoint CheckTeleport(FIntPoint Position);
 
+    UFUNCTION(BlueprintCallable, Category = "Stroke Game")
+    int32 GetTeleportPortalIDAt(FIntPoint Position) const;
+
+    const FStrokeGridLayout& GetGridLayout() const { return GridLayout; }
+
+    // Cells stepped off or teleported through this game; kept for the board renderer, which has no cell widgets
+    bool IsCellMarkedVisited(FIntPoint Position) const;
+
+    // Image and color for a cell in its current state, shared by UStrokeCell and the board renderer
+    UTexture2D* GetCellImage(EStrokeCellType CellType, int32 PortalID, bool bVisited) const;
+    FLinearColor GetCellColor(EStrokeCellType CellType, int32 PortalID, bool bVisited) const;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Images|Ground|Visited")
     UTexture2D* VisitedGroundRedImage;
 
@@ -361,6 +459,16 @@ protected:
     void UpdatePlayerVisual();
     void UpdatePathColor();
     bool AreAllRequiredPointsVisited() const;
+    void ResetProgressMasks();
+    void RebuildPathIndex();
+    int32 FindPathIndex(FIntPoint Position) const;
+    void RefreshCellPath(UStrokeCell* Cell);
+    void ClearProgress();
+    void ParkCells(int32 FirstParkedIndex);
+    void UpdatePathDisplayAt(TConstArrayView<FIntPoint> Positions);
+    void MarkCellVisited(FIntPoint Position, bool bVisited = true);
+    void ClearMoveHistory();
+    void RefreshBoard();
     bool IsRGBOrderCorrect() const;
     void OnGameWon();
     void ShowClearMessage();
@@ -381,9 +489,64 @@ protected:
 
     void LoadStageDataFromTable(const FStrokeStageData& StageData);
     FString GenerateRowNameFromStage(int32 StageNumber) const;
+    FStrokeStagePack* GetStagePack();
+
+    TSharedPtr<FStrokeStagePack, ESPMode::ThreadSafe> StagePack;
+    bool bStagePackOpened = false;
 
     UFUNCTION()
     void OnResetClicked();
 
+    void HandleHintReady(EStrokeHintResult Result, FIntPoint Direction, const FStrokeHintRequest& Request);
+    void ResetHintEngine();
+
+    TSharedPtr<FStrokeHintEngine, ESPMode::ThreadSafe> HintEngine;
+
+    FPuzzleReplayRecorder ReplayRecorder;
+    TSharedPtr<FPuzzleReplayPlayer> ReplayPlayer;
+
+    // Every cell widget created so far; the first CellWidgets.Num() are in use, the rest are parked
+    UPROPERTY(Transient)
+    TArray<UStrokeCell*> CellWidgetPool;
+
     FTimerHandle ClearMessageTimerHandle;
+
+    // Rebuilt from CurrentPuzzle in InitializeGrid
+    FStrokeGridLayout GridLayout;
+
+    // Cell index -> index into VisitedPositions
+    TArray<int32> PathIndexByCell;
+
+    // One bit per distinct required point cell
+    TBitArray<> VisitedRequiredMask;
+    int32 NumVisitedRequired = 0;
+
+    TBitArray<> VisitedCellMask;
+
+    // What one MovePlayer call changed, as GridLayout cell indices
+    struct FStrokeMoveDelta
+    {
+        int16 From = INDEX_NONE;
+
+        // Cell stepped into; To differs from it only after a teleport
+        int16 Entry = INDEX_NONE;
+        int16 To = INDEX_NONE;
+
+        int8 CollectedSlot = INDEX_NONE;
+
+        // VisitedCellMask bits of From, Entry and To before the move
+        uint8 PriorVisited = 0;
+
+        static constexpr uint8 FromVisited = 1 << 0;
+        static constexpr uint8 EntryVisited = 1 << 1;
+        static constexpr uint8 ToVisited = 1 << 2;
+    };
+
+    TArray<FStrokeMoveDelta> UndoStack;
+    TArray<FStrokeMoveDelta> RedoStack;
+    int32 CheckpointDepth = 0;
+    bool bRedoingMove = false;
+
+    UPROPERTY(Transient)
+    UStrokeBoardWidget* BoardWidget;
 };
\ No newline at end of file
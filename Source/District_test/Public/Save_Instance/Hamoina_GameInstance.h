@@ -189,7 +189,10 @@ public:
     void SetCurrentDialogueID(const FString& DialogueID);
 
 protected:
+    mutable TMap<FName, int32> StageNumberCache;
+
     void InitializeNewSaveData();
+    int32 ResolveStageNumber(UWorld* World) const;
     void CollectCurrentGameState();
     FString GetCustomSaveDirectory() const;
     FString GetAutoSaveDirectory() const;
@@ -62,7 +62,7 @@ public:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save Info")
     FString SaveDescription = TEXT("Auto Save");
 
-    // Game Data (  !)
+    // Game Data (여기 한 번만!)
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Game Data")
     FPlayerSaveData PlayerData;
 
@@ -79,7 +79,7 @@ public:
     FGameStatsSaveData StatsData;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Game Data")
-    FHintSaveData HintData;  // Ʈ  ߰
+    FHintSaveData HintData;  // 힌트 데이터 추가
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Level System")
     TMap<FString, bool> UnlockedLevels;
@@ -184,7 +184,7 @@ public:
     UFUNCTION(BlueprintPure, Category = "Stats")
     int32 GetUnlockedLevelCount() const;
 
-    // Hint System Functions (Ʈ Լ)
+    // Hint System Functions (힌트 함수들)
     UFUNCTION(BlueprintCallable, Category = "Hint")
     void InitializeHintForLevel(int32 LevelNumber);
 
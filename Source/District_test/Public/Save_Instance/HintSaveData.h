@@ -7,19 +7,19 @@ struct DISTRICT_TEST_API FHintBlockState
 {
     GENERATED_BODY()
 
-    //   ر  (6)
+    // 각 블록의 해금 상태 (6개)
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     TArray<bool> RevealedBlocks;
 
-    //  ٿ ð ()
+    // 현재 쿨다운 시간 (초)
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     float CurrentCooldown;
 
-    // ٿ  
+    // 쿨다운 중인지 여부
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     bool bIsOnCooldown;
 
-    //   ð (ٿ ð )
+    // 마지막 저장 시간 (쿨다운 시간 계산용)
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     FDateTime LastSaveTime;
 
@@ -41,7 +41,7 @@ struct DISTRICT_TEST_API FHintSaveData
 {
     GENERATED_BODY()
 
-    //  Ʈ  (LevelNumber -> HintBlockState)
+    // 레벨별 힌트 상태 (LevelNumber -> HintBlockState)
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     TMap<int32, FHintBlockState> LevelHintStates;
 